@@ -607,6 +607,67 @@ graphene_box_equal (const graphene_box_t *a,
          graphene_vec3_equal (&a->max, &b->max);
 }
 
+/**
+ * graphene_box_exact_equal:
+ * @a: a #graphene_box_t
+ * @b: a #graphene_box_t
+ *
+ * Checks whether the minimum and maximum vertices of the two given
+ * boxes are exactly equal; -0 and +0 are equal.
+ *
+ * Unlike graphene_box_equal(), this function does not account for
+ * floating point fluctuations, so that two equal boxes always have
+ * the same graphene_box_hash().
+ *
+ * Returns: `true` if the boxes are exactly equal
+ *
+ * Since: 1.4
+ */
+bool
+graphene_box_exact_equal (const graphene_box_t *a,
+                          const graphene_box_t *b)
+{
+  if (a == b)
+    return true;
+
+  if (a == NULL || b == NULL)
+    return false;
+
+  return graphene_simd4f_cmp_eq (graphene_simd4f_zero_w (a->min.value),
+                                 graphene_simd4f_zero_w (b->min.value)) &&
+         graphene_simd4f_cmp_eq (graphene_simd4f_zero_w (a->max.value),
+                                 graphene_simd4f_zero_w (b->max.value));
+}
+
+/**
+ * graphene_box_hash:
+ * @box: a #graphene_box_t
+ *
+ * Computes a hash value for the given #graphene_box_t, suitable
+ * for using boxes as keys in a hash table, together with
+ * graphene_box_exact_equal().
+ *
+ * The hash value is computed on the minimum and maximum vertices
+ * of the box; -0 and +0 have the same hash.
+ *
+ * This function cannot be used together with graphene_box_equal(),
+ * as boxes that are only nearly equal may have different hash values.
+ *
+ * Returns: the hash value of the box
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_box_hash (const graphene_box_t *box)
+{
+  float v[6];
+
+  graphene_simd4f_dup_3f (box->min.value, &v[0]);
+  graphene_simd4f_dup_3f (box->max.value, &v[3]);
+
+  return graphene_hash_floats (v, 6);
+}
+
 /**
  * graphene_box_get_bounding_sphere:
  * @box: a #graphene_box_t
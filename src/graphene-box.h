@@ -129,6 +129,11 @@ bool                    graphene_box_contains_box               (const graphene_
 GRAPHENE_AVAILABLE_IN_1_2
 bool                    graphene_box_equal                      (const graphene_box_t     *a,
                                                                  const graphene_box_t     *b);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_box_exact_equal                (const graphene_box_t     *a,
+                                                                 const graphene_box_t     *b);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int            graphene_box_hash                       (const graphene_box_t     *box);
 
 GRAPHENE_AVAILABLE_IN_1_2
 const graphene_box_t *  graphene_box_zero                       (void);
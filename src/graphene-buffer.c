@@ -0,0 +1,309 @@
+/* graphene-buffer.c: Packing into GPU buffers
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-buffer
+ * @Title: Buffers
+ * @Short_Description: Packing values into GPU buffers
+ *
+ * The functions in this section write arrays of #graphene_matrix_t,
+ * #graphene_matrix3x4_t, #graphene_box_t, and #graphene_sphere_t into a buffer of floating
+ * point values, in one of the layouts described by
+ * #graphene_buffer_layout_t, for instance to fill a mapped uniform or
+ * storage buffer before submitting a draw call.
+ *
+ * Each function returns the number of values written into the buffer,
+ * which must be large enough to hold them.
+ *
+ * When writing large arrays into a buffer aligned to 16 bytes, the
+ * values are written using non-temporal stores, where available, so
+ * that they do not evict the contents of the caches; the buffer is not
+ * expected to be read back by the CPU.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-buffer.h"
+
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+#include <stdint.h>
+
+/* the size of the data, in bytes, above which the stores bypass the
+ * caches; smaller arrays are likely to still be in the cache when the
+ * driver copies the buffer
+ */
+#define BUFFER_STREAM_THRESHOLD         (256 * 1024)
+
+/*< private >
+ * buffer_use_stream:
+ * @buffer: the destination buffer
+ * @n_values: the number of values to write
+ * @stride: the number of values of each element
+ *
+ * Checks whether the values should be written using non-temporal
+ * stores; each store must be aligned to 16 bytes.
+ */
+static inline bool
+buffer_use_stream (const float  *buffer,
+                   unsigned int  n_values,
+                   unsigned int  stride)
+{
+#if defined(GRAPHENE_USE_SSE)
+  return ((uintptr_t) buffer & 15) == 0 &&
+         (stride % 4) == 0 &&
+         (size_t) n_values * sizeof (float) >= BUFFER_STREAM_THRESHOLD;
+#else
+  return false;
+#endif
+}
+
+static inline void
+buffer_store (float                   *dst,
+              const graphene_simd4f_t  v,
+              bool                     stream)
+{
+#if defined(GRAPHENE_USE_SSE)
+  if (stream)
+    {
+      _mm_stream_ps (dst, v);
+      return;
+    }
+#endif
+
+  graphene_simd4f_dup_4f (v, dst);
+}
+
+static inline void
+buffer_end_stream (bool stream)
+{
+#if defined(GRAPHENE_USE_SSE)
+  /* make the non-temporal stores visible before the buffer is used */
+  if (stream)
+    _mm_sfence ();
+#endif
+}
+
+static unsigned int
+buffer_get_matrix_stride (graphene_buffer_layout_t layout)
+{
+  return layout == GRAPHENE_BUFFER_LAYOUT_3X4 ? 12 : 16;
+}
+
+static unsigned int
+buffer_get_box_stride (graphene_buffer_layout_t layout)
+{
+  return layout == GRAPHENE_BUFFER_LAYOUT_STD140 ||
+         layout == GRAPHENE_BUFFER_LAYOUT_STD430 ? 8 : 6;
+}
+
+/**
+ * graphene_buffer_pack_matrices:
+ * @layout: the layout of the values
+ * @n_matrices: the number of matrices to write
+ * @matrices: (array length=n_matrices): the matrices to write
+ * @buffer: (out caller-allocates): the buffer to write into; it must
+ *   be large enough to hold 16 values for each matrix, or 12 values
+ *   using the %GRAPHENE_BUFFER_LAYOUT_3X4 layout
+ *
+ * Writes an array of #graphene_matrix_t into @buffer, using the
+ * given @layout.
+ *
+ * Returns: the number of values written into @buffer
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_buffer_pack_matrices (graphene_buffer_layout_t  layout,
+                               unsigned int              n_matrices,
+                               const graphene_matrix_t   matrices[],
+                               float                    *buffer)
+{
+  unsigned int stride = buffer_get_matrix_stride (layout);
+  bool stream = buffer_use_stream (buffer, n_matrices * stride, stride);
+  float *dst = buffer;
+  unsigned int i;
+
+  for (i = 0; i < n_matrices; i++, dst += stride)
+    {
+      graphene_simd4x4f_t m = matrices[i].value;
+
+      if (layout != GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR)
+        graphene_simd4x4f_transpose_in_place (&m);
+
+      buffer_store (dst + 0, m.x, stream);
+      buffer_store (dst + 4, m.y, stream);
+      buffer_store (dst + 8, m.z, stream);
+
+      if (layout != GRAPHENE_BUFFER_LAYOUT_3X4)
+        buffer_store (dst + 12, m.w, stream);
+    }
+
+  buffer_end_stream (stream);
+
+  return n_matrices * stride;
+}
+
+/**
+ * graphene_buffer_pack_matrices3x4:
+ * @layout: the layout of the values
+ * @n_matrices: the number of matrices to write
+ * @matrices: (array length=n_matrices): the matrices to write
+ * @buffer: (out caller-allocates): the buffer to write into; it must
+ *   be large enough to hold 16 values for each matrix, or 12 values
+ *   using the %GRAPHENE_BUFFER_LAYOUT_3X4 layout
+ *
+ * Writes an array of #graphene_matrix3x4_t into @buffer, using the
+ * given @layout; the values are the same as the ones written by
+ * graphene_buffer_pack_matrices() for the corresponding affine
+ * #graphene_matrix_t.
+ *
+ * Returns: the number of values written into @buffer
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_buffer_pack_matrices3x4 (graphene_buffer_layout_t    layout,
+                                  unsigned int                n_matrices,
+                                  const graphene_matrix3x4_t  matrices[],
+                                  float                      *buffer)
+{
+  const graphene_simd4f_t last = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  unsigned int stride = buffer_get_matrix_stride (layout);
+  bool stream = buffer_use_stream (buffer, n_matrices * stride, stride);
+  float *dst = buffer;
+  unsigned int i;
+
+  for (i = 0; i < n_matrices; i++, dst += stride)
+    {
+      /* the matrix is already stored by column */
+      graphene_simd4x4f_t m = graphene_simd4x4f_init (matrices[i].x,
+                                                      matrices[i].y,
+                                                      matrices[i].z,
+                                                      last);
+
+      if (layout == GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR)
+        graphene_simd4x4f_transpose_in_place (&m);
+
+      buffer_store (dst + 0, m.x, stream);
+      buffer_store (dst + 4, m.y, stream);
+      buffer_store (dst + 8, m.z, stream);
+
+      if (layout != GRAPHENE_BUFFER_LAYOUT_3X4)
+        buffer_store (dst + 12, m.w, stream);
+    }
+
+  buffer_end_stream (stream);
+
+  return n_matrices * stride;
+}
+
+/**
+ * graphene_buffer_pack_boxes:
+ * @layout: the layout of the values
+ * @n_boxes: the number of boxes to write
+ * @boxes: (array length=n_boxes): the boxes to write
+ * @buffer: (out caller-allocates): the buffer to write into; it must
+ *   be large enough to hold 6 values for each box, or 8 values using
+ *   the %GRAPHENE_BUFFER_LAYOUT_STD140 and %GRAPHENE_BUFFER_LAYOUT_STD430
+ *   layouts
+ *
+ * Writes an array of #graphene_box_t into @buffer, using the
+ * given @layout.
+ *
+ * Returns: the number of values written into @buffer
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_buffer_pack_boxes (graphene_buffer_layout_t  layout,
+                            unsigned int              n_boxes,
+                            const graphene_box_t      boxes[],
+                            float                    *buffer)
+{
+  unsigned int stride = buffer_get_box_stride (layout);
+  bool stream = buffer_use_stream (buffer, n_boxes * stride, stride);
+  float *dst = buffer;
+  unsigned int i;
+
+  if (stride == 8)
+    {
+      for (i = 0; i < n_boxes; i++, dst += stride)
+        {
+          buffer_store (dst + 0, graphene_simd4f_zero_w (boxes[i].min.value), stream);
+          buffer_store (dst + 4, graphene_simd4f_zero_w (boxes[i].max.value), stream);
+        }
+
+      buffer_end_stream (stream);
+    }
+  else
+    {
+      for (i = 0; i < n_boxes; i++, dst += stride)
+        {
+          graphene_simd4f_dup_3f (boxes[i].min.value, dst + 0);
+          graphene_simd4f_dup_3f (boxes[i].max.value, dst + 3);
+        }
+    }
+
+  return n_boxes * stride;
+}
+
+/**
+ * graphene_buffer_pack_spheres:
+ * @layout: the layout of the values
+ * @n_spheres: the number of spheres to write
+ * @spheres: (array length=n_spheres): the spheres to write
+ * @buffer: (out caller-allocates): the buffer to write into; it must
+ *   be large enough to hold 4 values for each sphere
+ *
+ * Writes an array of #graphene_sphere_t into @buffer, using the
+ * given @layout; the center of each sphere is followed by its radius,
+ * in all layouts.
+ *
+ * Returns: the number of values written into @buffer
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_buffer_pack_spheres (graphene_buffer_layout_t  layout,
+                              unsigned int              n_spheres,
+                              const graphene_sphere_t   spheres[],
+                              float                    *buffer)
+{
+  bool stream = buffer_use_stream (buffer, n_spheres * 4, 4);
+  float *dst = buffer;
+  unsigned int i;
+
+  for (i = 0; i < n_spheres; i++, dst += 4)
+    {
+      graphene_simd4f_t v;
+
+      v = graphene_simd4f_merge_w (spheres[i].center.value, spheres[i].radius);
+      buffer_store (dst, v, stream);
+    }
+
+  buffer_end_stream (stream);
+
+  return n_spheres * 4;
+}
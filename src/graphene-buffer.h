@@ -0,0 +1,100 @@
+/* graphene-buffer.h: Packing into GPU buffers
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_BUFFER_H__
+#define __GRAPHENE_BUFFER_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-box.h"
+#include "graphene-matrix.h"
+#include "graphene-matrix3x4.h"
+#include "graphene-sphere.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_buffer_layout_t:
+ * @GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR: Tightly packed values; matrices
+ *   use 16 values, in the same order as graphene_matrix_to_float()
+ * @GRAPHENE_BUFFER_LAYOUT_COLUMN_MAJOR: Tightly packed values; matrices
+ *   use 16 values, stored by column
+ * @GRAPHENE_BUFFER_LAYOUT_3X4: Tightly packed values; matrices use 12
+ *   values, with the first three columns stored as rows, and the last
+ *   column dropped
+ * @GRAPHENE_BUFFER_LAYOUT_STD140: The std140 layout of GLSL uniform
+ *   blocks; matrices are stored as a `mat4`, by column, and each
+ *   three-component vector is padded to four values
+ * @GRAPHENE_BUFFER_LAYOUT_STD430: The std430 layout of GLSL storage
+ *   blocks; for the types packed by Graphene, it is the same as the
+ *   std140 layout
+ *
+ * The layout of the values written by graphene_buffer_pack_matrices()
+ * and friends.
+ *
+ * Boxes use 6 values, the minimum vertex followed by the maximum
+ * vertex, and 8 values in the std140 and std430 layouts. Spheres
+ * always use 4 values, the center followed by the radius.
+ *
+ * The %GRAPHENE_BUFFER_LAYOUT_3X4 layout of a matrix is the upper
+ * 3x4 component of the transformation that applies to column vectors,
+ * and can be used for affine transformations, like the transformation
+ * of an instance in a ray tracing acceleration structure.
+ *
+ * Since: 1.4
+ */
+typedef enum {
+  GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR,
+  GRAPHENE_BUFFER_LAYOUT_COLUMN_MAJOR,
+  GRAPHENE_BUFFER_LAYOUT_3X4,
+  GRAPHENE_BUFFER_LAYOUT_STD140,
+  GRAPHENE_BUFFER_LAYOUT_STD430
+} graphene_buffer_layout_t;
+
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int    graphene_buffer_pack_matrices   (graphene_buffer_layout_t  layout,
+                                                 unsigned int              n_matrices,
+                                                 const graphene_matrix_t   matrices[],
+                                                 float                    *buffer);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int    graphene_buffer_pack_matrices3x4 (graphene_buffer_layout_t  layout,
+                                                 unsigned int              n_matrices,
+                                                 const graphene_matrix3x4_t matrices[],
+                                                 float                    *buffer);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int    graphene_buffer_pack_boxes      (graphene_buffer_layout_t  layout,
+                                                 unsigned int              n_boxes,
+                                                 const graphene_box_t      boxes[],
+                                                 float                    *buffer);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int    graphene_buffer_pack_spheres    (graphene_buffer_layout_t  layout,
+                                                 unsigned int              n_spheres,
+                                                 const graphene_sphere_t   spheres[],
+                                                 float                    *buffer);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_BUFFER_H__ */
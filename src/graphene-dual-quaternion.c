@@ -0,0 +1,478 @@
+/* graphene-dual-quaternion.c: Dual quaternion
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-dual-quaternion
+ * @Title: Dual quaternion
+ * @Short_Description: Rigid transformations
+ *
+ * A dual quaternion is a pair of quaternions describing a rigid
+ * transformation: the real part is the rotation, and the dual part
+ * encodes the translation applied after the rotation.
+ *
+ * Unlike matrices, dual quaternions can be blended together without
+ * introducing a scale in the result; this makes them a good choice for
+ * skinning, where blending the matrices of the bones causes the
+ * collapse of the mesh around twisting joints. See
+ * graphene_skin_vertices_blend_dual_quaternions().
+ *
+ * A #graphene_dual_quaternion_t also uses half the memory of a
+ * #graphene_matrix_t.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-dual-quaternion.h"
+#include "graphene-quaternion-private.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-matrix.h"
+#include "graphene-point3d.h"
+#include "graphene-simd4f.h"
+
+/**
+ * graphene_dual_quaternion_alloc: (constructor)
+ *
+ * Allocates a new #graphene_dual_quaternion_t.
+ *
+ * The contents of the returned value are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_dual_quaternion_t
+ *
+ * Since: 1.4
+ */
+graphene_dual_quaternion_t *
+graphene_dual_quaternion_alloc (void)
+{
+  return calloc (1, sizeof (graphene_dual_quaternion_t));
+}
+
+/**
+ * graphene_dual_quaternion_free:
+ * @dq: a #graphene_dual_quaternion_t
+ *
+ * Releases the resources allocated by graphene_dual_quaternion_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_free (graphene_dual_quaternion_t *dq)
+{
+  free (dq);
+}
+
+/**
+ * graphene_dual_quaternion_init:
+ * @dq: a #graphene_dual_quaternion_t
+ * @real: the real part
+ * @dual: the dual part
+ *
+ * Initializes a #graphene_dual_quaternion_t using its two parts.
+ *
+ * Returns: (transfer none): the initialized dual quaternion
+ *
+ * Since: 1.4
+ */
+graphene_dual_quaternion_t *
+graphene_dual_quaternion_init (graphene_dual_quaternion_t  *dq,
+                               const graphene_quaternion_t *real,
+                               const graphene_quaternion_t *dual)
+{
+  dq->real = *real;
+  dq->dual = *dual;
+
+  return dq;
+}
+
+/**
+ * graphene_dual_quaternion_init_identity:
+ * @dq: a #graphene_dual_quaternion_t
+ *
+ * Initializes a #graphene_dual_quaternion_t with the identity
+ * transformation.
+ *
+ * Returns: (transfer none): the initialized dual quaternion
+ *
+ * Since: 1.4
+ */
+graphene_dual_quaternion_t *
+graphene_dual_quaternion_init_identity (graphene_dual_quaternion_t *dq)
+{
+  graphene_quaternion_init_identity (&dq->real);
+  graphene_quaternion_init (&dq->dual, 0.f, 0.f, 0.f, 0.f);
+
+  return dq;
+}
+
+/**
+ * graphene_dual_quaternion_init_from_dual_quaternion:
+ * @dq: a #graphene_dual_quaternion_t
+ * @src: a #graphene_dual_quaternion_t
+ *
+ * Initializes a #graphene_dual_quaternion_t with the values of @src.
+ *
+ * Returns: (transfer none): the initialized dual quaternion
+ *
+ * Since: 1.4
+ */
+graphene_dual_quaternion_t *
+graphene_dual_quaternion_init_from_dual_quaternion (graphene_dual_quaternion_t       *dq,
+                                                    const graphene_dual_quaternion_t *src)
+{
+  *dq = *src;
+
+  return dq;
+}
+
+/**
+ * graphene_dual_quaternion_init_from_rotation:
+ * @dq: a #graphene_dual_quaternion_t
+ * @rotation: a unit #graphene_quaternion_t describing the rotation
+ * @translation: the translation applied after the rotation
+ *
+ * Initializes a #graphene_dual_quaternion_t with a rotation, followed
+ * by a translation.
+ *
+ * Returns: (transfer none): the initialized dual quaternion
+ *
+ * Since: 1.4
+ */
+graphene_dual_quaternion_t *
+graphene_dual_quaternion_init_from_rotation (graphene_dual_quaternion_t  *dq,
+                                             const graphene_quaternion_t *rotation,
+                                             const graphene_vec3_t       *translation)
+{
+  graphene_simd4f_t r, d;
+
+  r = graphene_quaternion_load (rotation);
+
+  /* d = ½ * t * r, with t as a pure quaternion */
+  d = graphene_quaternion_simd_multiply (graphene_simd4f_zero_w (translation->value), r);
+  d = graphene_simd4f_mul (d, graphene_simd4f_splat (0.5f));
+
+  graphene_quaternion_store (r, &dq->real);
+  graphene_quaternion_store (d, &dq->dual);
+
+  return dq;
+}
+
+/**
+ * graphene_dual_quaternion_init_from_matrix:
+ * @dq: a #graphene_dual_quaternion_t
+ * @m: a #graphene_matrix_t
+ *
+ * Initializes a #graphene_dual_quaternion_t using the rotation and
+ * the translation of the given #graphene_matrix_t.
+ *
+ * Dual quaternions can only describe rigid transformations; the
+ * rotation is extracted after orthonormalizing the upper 3x3 part
+ * of the matrix, so that any scale, shear or reflection is discarded,
+ * like in graphene_matrix_decompose(). Any projection is discarded
+ * as well.
+ *
+ * Returns: (transfer none): the initialized dual quaternion
+ *
+ * Since: 1.4
+ */
+graphene_dual_quaternion_t *
+graphene_dual_quaternion_init_from_matrix (graphene_dual_quaternion_t *dq,
+                                           const graphene_matrix_t    *m)
+{
+  graphene_simd4f_t row_x, row_y, row_z, cross;
+  graphene_simd4x4f_t rows;
+  graphene_quaternion_t rotation;
+  graphene_vec3_t translation;
+
+  row_x = graphene_simd4f_zero_w (m->value.x);
+  row_y = graphene_simd4f_zero_w (m->value.y);
+  row_z = graphene_simd4f_zero_w (m->value.z);
+
+  /* Gram-Schmidt, to remove the scale and shear factors */
+  row_x = graphene_simd4f_normalize3 (row_x);
+  row_y = graphene_simd4f_sub (row_y, graphene_simd4f_mul (row_x, graphene_simd4f_dot3 (row_x, row_y)));
+  row_y = graphene_simd4f_normalize3 (row_y);
+  row_z = graphene_simd4f_sub (row_z, graphene_simd4f_mul (row_x, graphene_simd4f_dot3 (row_x, row_z)));
+  row_z = graphene_simd4f_sub (row_z, graphene_simd4f_mul (row_y, graphene_simd4f_dot3 (row_y, row_z)));
+  row_z = graphene_simd4f_normalize3 (row_z);
+
+  /* a coordinate system flip is a negative scale, not a rotation */
+  cross = graphene_simd4f_cross3 (row_y, row_z);
+  if (graphene_simd4f_dot3_scalar (row_x, cross) < 0.f)
+    {
+      row_x = graphene_simd4f_neg (row_x);
+      row_y = graphene_simd4f_neg (row_y);
+      row_z = graphene_simd4f_neg (row_z);
+    }
+
+  rows = graphene_simd4x4f_init (row_x, row_y, row_z,
+                                 graphene_simd4f_init (0.f, 0.f, 0.f, 1.f));
+  graphene_quaternion_store (graphene_quaternion_simd_from_matrix (&rows), &rotation);
+
+  translation.value = graphene_simd4f_zero_w (m->value.w);
+
+  return graphene_dual_quaternion_init_from_rotation (dq, &rotation, &translation);
+}
+
+/**
+ * graphene_dual_quaternion_to_matrix:
+ * @dq: a unit #graphene_dual_quaternion_t
+ * @m: (out caller-allocates): return location for the matrix
+ *
+ * Converts a #graphene_dual_quaternion_t into the #graphene_matrix_t
+ * describing the same rigid transformation.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_to_matrix (const graphene_dual_quaternion_t *dq,
+                                    graphene_matrix_t                *m)
+{
+  graphene_simd4f_t t;
+
+  t = graphene_dual_quaternion_simd_translation (graphene_quaternion_load (&dq->real),
+                                                 graphene_quaternion_load (&dq->dual));
+
+  graphene_quaternion_to_matrix (&dq->real, m);
+  m->value.w = graphene_simd4f_merge_w (t, 1.f);
+}
+
+/**
+ * graphene_dual_quaternion_get_real:
+ * @dq: a #graphene_dual_quaternion_t
+ * @res: (out caller-allocates): return location for the real part
+ *
+ * Retrieves the real part of a #graphene_dual_quaternion_t, which is
+ * the rotation of the transformation.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_get_real (const graphene_dual_quaternion_t *dq,
+                                   graphene_quaternion_t            *res)
+{
+  *res = dq->real;
+}
+
+/**
+ * graphene_dual_quaternion_get_dual:
+ * @dq: a #graphene_dual_quaternion_t
+ * @res: (out caller-allocates): return location for the dual part
+ *
+ * Retrieves the dual part of a #graphene_dual_quaternion_t.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_get_dual (const graphene_dual_quaternion_t *dq,
+                                   graphene_quaternion_t            *res)
+{
+  *res = dq->dual;
+}
+
+/**
+ * graphene_dual_quaternion_get_translation:
+ * @dq: a unit #graphene_dual_quaternion_t
+ * @res: (out caller-allocates): return location for the translation
+ *
+ * Retrieves the translation of the transformation described by a
+ * #graphene_dual_quaternion_t.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_get_translation (const graphene_dual_quaternion_t *dq,
+                                          graphene_vec3_t                  *res)
+{
+  res->value = graphene_dual_quaternion_simd_translation (graphene_quaternion_load (&dq->real),
+                                                          graphene_quaternion_load (&dq->dual));
+}
+
+/*< private >
+ * dual_quaternion_normalize:
+ * @r: (inout): the real part
+ * @d: (inout): the dual part
+ *
+ * Scales both parts by the inverse length of the real part, and removes
+ * the component of the dual part parallel to the real part, so that the
+ * dual quaternion describes a rigid transformation.
+ */
+static inline void
+dual_quaternion_normalize (graphene_simd4f_t *r,
+                           graphene_simd4f_t *d)
+{
+  graphene_simd4f_t len, dot;
+
+  len = graphene_simd4f_length4 (*r);
+  if (graphene_simd4f_get_x (len) == 0.f)
+    return;
+
+  *r = graphene_simd4f_div (*r, len);
+  *d = graphene_simd4f_div (*d, len);
+
+  dot = graphene_simd4f_dot4 (*r, *d);
+  *d = graphene_simd4f_sub (*d, graphene_simd4f_mul (*r, dot));
+}
+
+/**
+ * graphene_dual_quaternion_normalize:
+ * @dq: a #graphene_dual_quaternion_t
+ * @res: (out caller-allocates): return location for the normalized
+ *   dual quaternion
+ *
+ * Normalizes a #graphene_dual_quaternion_t, so that it describes a
+ * rigid transformation.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_normalize (const graphene_dual_quaternion_t *dq,
+                                    graphene_dual_quaternion_t       *res)
+{
+  graphene_simd4f_t r, d;
+
+  r = graphene_quaternion_load (&dq->real);
+  d = graphene_quaternion_load (&dq->dual);
+
+  dual_quaternion_normalize (&r, &d);
+
+  graphene_quaternion_store (r, &res->real);
+  graphene_quaternion_store (d, &res->dual);
+}
+
+/**
+ * graphene_dual_quaternion_multiply:
+ * @a: a #graphene_dual_quaternion_t
+ * @b: a #graphene_dual_quaternion_t
+ * @res: (out caller-allocates): return location for the product
+ *
+ * Multiplies two dual quaternions; the resulting transformation
+ * applies @b first, and then @a.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_multiply (const graphene_dual_quaternion_t *a,
+                                   const graphene_dual_quaternion_t *b,
+                                   graphene_dual_quaternion_t       *res)
+{
+  graphene_simd4f_t a_r, a_d, b_r, b_d, r, d;
+
+  a_r = graphene_quaternion_load (&a->real);
+  a_d = graphene_quaternion_load (&a->dual);
+  b_r = graphene_quaternion_load (&b->real);
+  b_d = graphene_quaternion_load (&b->dual);
+
+  /* (a_r + ε a_d) * (b_r + ε b_d) = a_r * b_r + ε (a_r * b_d + a_d * b_r) */
+  r = graphene_quaternion_simd_multiply (a_r, b_r);
+  d = graphene_simd4f_add (graphene_quaternion_simd_multiply (a_r, b_d),
+                           graphene_quaternion_simd_multiply (a_d, b_r));
+
+  graphene_quaternion_store (r, &res->real);
+  graphene_quaternion_store (d, &res->dual);
+}
+
+/**
+ * graphene_dual_quaternion_blend:
+ * @n_dual_quaternions: the number of dual quaternions
+ * @dq: (array length=n_dual_quaternions): the dual quaternions to blend
+ * @weights: (array length=n_dual_quaternions): the weight of each
+ *   dual quaternion
+ * @res: (out caller-allocates): return location for the blended
+ *   dual quaternion
+ *
+ * Blends the given dual quaternions using their weights, and normalizes
+ * the result.
+ *
+ * Each dual quaternion is negated, if needed, so that it lies on the
+ * same hemisphere as the first one; this ensures that the blend always
+ * follows the shortest path between the rotations.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_blend (unsigned int                     n_dual_quaternions,
+                                const graphene_dual_quaternion_t dq[],
+                                const float                      weights[],
+                                graphene_dual_quaternion_t      *res)
+{
+  graphene_simd4f_t pivot, r, d;
+  unsigned int i;
+
+  if (n_dual_quaternions == 0)
+    {
+      graphene_dual_quaternion_init_identity (res);
+      return;
+    }
+
+  pivot = graphene_quaternion_load (&dq[0].real);
+  r = d = graphene_simd4f_splat (0.f);
+
+  for (i = 0; i < n_dual_quaternions; i++)
+    {
+      graphene_simd4f_t i_r = graphene_quaternion_load (&dq[i].real);
+      graphene_simd4f_t w;
+
+      if (graphene_quaternion_simd_dot (i_r, pivot) < 0.f)
+        w = graphene_simd4f_splat (-weights[i]);
+      else
+        w = graphene_simd4f_splat (weights[i]);
+
+      r = graphene_simd4f_madd (i_r, w, r);
+      d = graphene_simd4f_madd (graphene_quaternion_load (&dq[i].dual), w, d);
+    }
+
+  dual_quaternion_normalize (&r, &d);
+
+  graphene_quaternion_store (r, &res->real);
+  graphene_quaternion_store (d, &res->dual);
+}
+
+/**
+ * graphene_dual_quaternion_transform_point3d:
+ * @dq: a unit #graphene_dual_quaternion_t
+ * @p: a #graphene_point3d_t
+ * @res: (out caller-allocates): return location for the transformed point
+ *
+ * Transforms a #graphene_point3d_t using the rigid transformation
+ * described by a #graphene_dual_quaternion_t.
+ *
+ * Since: 1.4
+ */
+void
+graphene_dual_quaternion_transform_point3d (const graphene_dual_quaternion_t *dq,
+                                            const graphene_point3d_t         *p,
+                                            graphene_point3d_t               *res)
+{
+  graphene_simd4f_t r, d, v;
+
+  r = graphene_quaternion_load (&dq->real);
+  d = graphene_quaternion_load (&dq->dual);
+
+  v = graphene_simd4f_init (p->x, p->y, p->z, 0.f);
+  v = graphene_quaternion_simd_rotate (r, graphene_simd4f_splat_w (r), v);
+  v = graphene_simd4f_add (v, graphene_dual_quaternion_simd_translation (r, d));
+
+  res->x = graphene_simd4f_get_x (v);
+  res->y = graphene_simd4f_get_y (v);
+  res->z = graphene_simd4f_get_z (v);
+}
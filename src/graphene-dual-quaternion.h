@@ -0,0 +1,108 @@
+/* graphene-dual-quaternion.h: Dual quaternion
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_DUAL_QUATERNION_H__
+#define __GRAPHENE_DUAL_QUATERNION_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-quaternion.h"
+#include "graphene-vec3.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_dual_quaternion_t:
+ *
+ * A dual quaternion, describing a rigid transformation.
+ *
+ * The contents of the #graphene_dual_quaternion_t structure are private
+ * and should never be accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_dual_quaternion_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_quaternion_t, real);
+  GRAPHENE_PRIVATE_FIELD (graphene_quaternion_t, dual);
+};
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_dual_quaternion_t *  graphene_dual_quaternion_alloc                      (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_free                       (graphene_dual_quaternion_t       *dq);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_dual_quaternion_t *  graphene_dual_quaternion_init                       (graphene_dual_quaternion_t       *dq,
+                                                                                   const graphene_quaternion_t      *real,
+                                                                                   const graphene_quaternion_t      *dual);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_dual_quaternion_t *  graphene_dual_quaternion_init_identity              (graphene_dual_quaternion_t       *dq);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_dual_quaternion_t *  graphene_dual_quaternion_init_from_dual_quaternion  (graphene_dual_quaternion_t       *dq,
+                                                                                   const graphene_dual_quaternion_t *src);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_dual_quaternion_t *  graphene_dual_quaternion_init_from_rotation         (graphene_dual_quaternion_t       *dq,
+                                                                                   const graphene_quaternion_t      *rotation,
+                                                                                   const graphene_vec3_t            *translation);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_dual_quaternion_t *  graphene_dual_quaternion_init_from_matrix           (graphene_dual_quaternion_t       *dq,
+                                                                                   const graphene_matrix_t          *m);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_to_matrix                  (const graphene_dual_quaternion_t *dq,
+                                                                                   graphene_matrix_t                *m);
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_get_real                   (const graphene_dual_quaternion_t *dq,
+                                                                                   graphene_quaternion_t            *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_get_dual                   (const graphene_dual_quaternion_t *dq,
+                                                                                   graphene_quaternion_t            *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_get_translation            (const graphene_dual_quaternion_t *dq,
+                                                                                   graphene_vec3_t                  *res);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_normalize                  (const graphene_dual_quaternion_t *dq,
+                                                                                   graphene_dual_quaternion_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_multiply                   (const graphene_dual_quaternion_t *a,
+                                                                                   const graphene_dual_quaternion_t *b,
+                                                                                   graphene_dual_quaternion_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_blend                      (unsigned int                      n_dual_quaternions,
+                                                                                   const graphene_dual_quaternion_t  dq[],
+                                                                                   const float                       weights[],
+                                                                                   graphene_dual_quaternion_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                          graphene_dual_quaternion_transform_point3d          (const graphene_dual_quaternion_t *dq,
+                                                                                   const graphene_point3d_t         *p,
+                                                                                   graphene_point3d_t               *res);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_DUAL_QUATERNION_H__ */
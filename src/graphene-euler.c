@@ -47,6 +47,9 @@
 #include "graphene-alloc-private.h"
 #include "graphene-matrix.h"
 #include "graphene-quaternion.h"
+#include "graphene-quaternion-private.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
 #include "graphene-vectors-private.h"
 
 #define EULER_DEFAULT_ORDER     GRAPHENE_EULER_ORDER_XYZ
@@ -180,7 +183,7 @@ graphene_euler_init_from_matrix (graphene_euler_t        *e,
                                  const graphene_matrix_t *m,
                                  graphene_euler_order_t   order)
 {
-  float me[16];
+  float r0[3], r1[3], r2[3];
   float m11, m12, m13;
   float m21, m22, m23;
   float m31, m32, m33;
@@ -189,12 +192,14 @@ graphene_euler_init_from_matrix (graphene_euler_t        *e,
   if (m == NULL)
     return graphene_euler_init_with_order (e, 0.f, 0.f, 0.f, order);
 
-  graphene_matrix_to_float (m, me);
-
   /* isolate the rotation components */
-  m11 = me[0]; m21 = me[4]; m31 = me[8];
-  m12 = me[1]; m22 = me[5]; m32 = me[9];
-  m13 = me[2]; m23 = me[6]; m33 = me[10];
+  graphene_simd4f_dup_3f (m->value.x, r0);
+  graphene_simd4f_dup_3f (m->value.y, r1);
+  graphene_simd4f_dup_3f (m->value.z, r2);
+
+  m11 = r0[0]; m21 = r1[0]; m31 = r2[0];
+  m12 = r0[1]; m22 = r1[1]; m32 = r2[1];
+  m13 = r0[2]; m23 = r1[2]; m33 = r2[2];
 
   x = y = z = 0.f;
 
@@ -695,6 +700,619 @@ graphene_euler_to_matrix (const graphene_euler_t *e,
     }
 }
 
+/*< private >
+ * euler_simd_sincos:
+ * @angle: four angles, in radians
+ * @sin_out: (out): return location for the sines of the angles
+ * @cos_out: (out): return location for the cosines of the angles
+ *
+ * Computes the sine and cosine of four angles at once.
+ *
+ * Each angle is reduced to the [-π/4, π/4] range around the nearest
+ * multiple of π/2, using a three-part π/2 to keep the precision of the
+ * reduction; the sine and cosine of the reduced angle are evaluated
+ * with minimax polynomials, and then swapped and negated depending
+ * on the quadrant. The result is within a few ULPs of sinf() and cosf()
+ * for angles up to a few thousand radians.
+ */
+static inline void
+euler_simd_sincos (const graphene_simd4f_t  angle,
+                   graphene_simd4f_t       *sin_out,
+                   graphene_simd4f_t       *cos_out)
+{
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  graphene_simd4f_t r, r2, s, c, k_v, swap, sign_s, sign_c;
+  float a[4], k[4], sw[4], ss[4], sc[4];
+  unsigned int i;
+
+  /* the quadrant is selected per lane, as we cannot convert a
+   * vector to integers
+   */
+  graphene_simd4f_dup_4f (angle, a);
+  for (i = 0; i < 4; i++)
+    {
+      int q = (int) floorf (a[i] * (float) (2.0 / GRAPHENE_PI) + 0.5f);
+
+      k[i] = (float) q;
+      sw[i] = (float) (q & 1);
+      ss[i] = (q & 2) ? -1.f : 1.f;
+      sc[i] = ((q + 1) & 2) ? -1.f : 1.f;
+    }
+
+  k_v = graphene_simd4f_init_4f (k);
+  swap = graphene_simd4f_init_4f (sw);
+  sign_s = graphene_simd4f_init_4f (ss);
+  sign_c = graphene_simd4f_init_4f (sc);
+
+  r = graphene_simd4f_sub (angle, graphene_simd4f_mul (k_v, graphene_simd4f_splat (1.5703125f)));
+  r = graphene_simd4f_sub (r, graphene_simd4f_mul (k_v, graphene_simd4f_splat (4.837512969970703125e-4f)));
+  r = graphene_simd4f_sub (r, graphene_simd4f_mul (k_v, graphene_simd4f_splat (7.54978995489188216e-8f)));
+  r2 = graphene_simd4f_mul (r, r);
+
+  s = graphene_simd4f_madd (r2, graphene_simd4f_splat (-1.9515295891e-4f), graphene_simd4f_splat (8.3321608736e-3f));
+  s = graphene_simd4f_madd (r2, s, graphene_simd4f_splat (-1.6666654611e-1f));
+  s = graphene_simd4f_madd (graphene_simd4f_mul (r2, r), s, r);
+
+  c = graphene_simd4f_madd (r2, graphene_simd4f_splat (2.443315711809948e-5f), graphene_simd4f_splat (-1.388731625493765e-3f));
+  c = graphene_simd4f_madd (r2, c, graphene_simd4f_splat (4.166664568298827e-2f));
+  c = graphene_simd4f_mul (graphene_simd4f_mul (r2, r2), c);
+  c = graphene_simd4f_add (graphene_simd4f_sub (one, graphene_simd4f_mul (r2, graphene_simd4f_splat (0.5f))), c);
+
+  /* odd quadrants swap the sine and the cosine */
+  *sin_out = graphene_simd4f_mul (graphene_simd4f_madd (c, swap, graphene_simd4f_mul (s, graphene_simd4f_sub (one, swap))), sign_s);
+  *cos_out = graphene_simd4f_mul (graphene_simd4f_madd (s, swap, graphene_simd4f_mul (c, graphene_simd4f_sub (one, swap))), sign_c);
+}
+
+/*< private >
+ * euler_simd_atan2:
+ * @y: four ordinates
+ * @x: four abscissae
+ *
+ * Computes the arc tangent of @y / @x for four pairs at once, using
+ * the signs of both to determine the quadrant, like atan2f().
+ *
+ * The ratio of the smaller to the larger magnitude is halved in angle
+ * using atan(t) = 2 · atan(t / (1 + √(1 + t²))), which brings it in the
+ * [0, tan(π/8)] range of a minimax polynomial without any branch; the
+ * octant is then restored with a per-lane offset and sign.
+ *
+ * Returns: the four angles, in radians
+ */
+static inline graphene_simd4f_t
+euler_simd_atan2 (const graphene_simd4f_t y,
+                  const graphene_simd4f_t x)
+{
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  graphene_simd4f_t abs_x, abs_y, lo, hi, t, t2, r;
+  float vx[4], vy[4], offset[4], factor[4];
+  unsigned int i;
+
+  abs_x = graphene_simd4f_max (x, graphene_simd4f_neg (x));
+  abs_y = graphene_simd4f_max (y, graphene_simd4f_neg (y));
+
+  lo = graphene_simd4f_min (abs_x, abs_y);
+  hi = graphene_simd4f_max (abs_x, abs_y);
+  hi = graphene_simd4f_max (hi, graphene_simd4f_splat (FLT_MIN));
+
+  t = graphene_simd4f_div (lo, hi);
+  t = graphene_simd4f_div (t, graphene_simd4f_add (one, graphene_simd4f_sqrt (graphene_simd4f_madd (t, t, one))));
+  t2 = graphene_simd4f_mul (t, t);
+
+  r = graphene_simd4f_madd (t2, graphene_simd4f_splat (8.05374449538e-2f), graphene_simd4f_splat (-1.38776856032e-1f));
+  r = graphene_simd4f_madd (t2, r, graphene_simd4f_splat (1.99777106478e-1f));
+  r = graphene_simd4f_madd (t2, r, graphene_simd4f_splat (-3.33329491539e-1f));
+  r = graphene_simd4f_madd (graphene_simd4f_mul (t2, t), r, t);
+
+  /* r is in [0, π/8]; the octant is selected per lane, folding
+   * r' = π/2 - r, r'' = π - r', and -r'' into a single madd
+   */
+  graphene_simd4f_dup_4f (x, vx);
+  graphene_simd4f_dup_4f (y, vy);
+  for (i = 0; i < 4; i++)
+    {
+      float a = 0.f, b = 2.f;
+
+      if (fabsf (vy[i]) > fabsf (vx[i]))
+        {
+          a = GRAPHENE_PI_2;
+          b = -b;
+        }
+
+      if (signbit (vx[i]))
+        {
+          a = GRAPHENE_PI - a;
+          b = -b;
+        }
+
+      if (signbit (vy[i]))
+        {
+          a = -a;
+          b = -b;
+        }
+
+      offset[i] = a;
+      factor[i] = b;
+    }
+
+  return graphene_simd4f_madd (r, graphene_simd4f_init_4f (factor), graphene_simd4f_init_4f (offset));
+}
+
+/*< private >
+ * euler_load_soa:
+ * @e: an array of #graphene_euler_t
+ * @n: the number of elements to load, up to 4
+ * @x: (out): return location for the angles on the X axis, in radians
+ * @y: (out): return location for the angles on the Y axis, in radians
+ * @z: (out): return location for the angles on the Z axis, in radians
+ *
+ * Loads the angles of up to four #graphene_euler_t, transposed so
+ * that each vector holds the same angle of every element.
+ *
+ * Returns: the order of the rotations, or %GRAPHENE_EULER_ORDER_DEFAULT
+ *   if the elements use different orders
+ */
+static inline graphene_euler_order_t
+euler_load_soa (const graphene_euler_t  e[],
+                unsigned int            n,
+                graphene_simd4f_t      *x,
+                graphene_simd4f_t      *y,
+                graphene_simd4f_t      *z)
+{
+  const graphene_simd4f_t zero = graphene_simd4f_init_zero ();
+  graphene_euler_order_t order = graphene_euler_get_order (&e[0]);
+  graphene_simd4x4f_t m;
+  unsigned int i;
+
+  for (i = 1; i < n; i++)
+    {
+      if (graphene_euler_get_order (&e[i]) != order)
+        return GRAPHENE_EULER_ORDER_DEFAULT;
+    }
+
+  m = graphene_simd4x4f_init (e[0].angles.value,
+                              n > 1 ? e[1].angles.value : zero,
+                              n > 2 ? e[2].angles.value : zero,
+                              n > 3 ? e[3].angles.value : zero);
+  graphene_simd4x4f_transpose_in_place (&m);
+
+  *x = m.x;
+  *y = m.y;
+  *z = m.z;
+
+  return order;
+}
+
+/**
+ * graphene_euler_to_matrix_array:
+ * @n_eulers: the number of #graphene_euler_t
+ * @e: (array length=n_eulers): an array of #graphene_euler_t
+ * @res: (array length=n_eulers) (out caller-allocates): return location
+ *   for the transformation matrices
+ *
+ * Converts each #graphene_euler_t in the @e array into a transformation
+ * matrix; see graphene_euler_to_matrix().
+ *
+ * The elements are converted four at a time, computing the sine and
+ * cosine of all their angles at once. Consecutive elements should use
+ * the same order of rotations; four elements that do not are converted
+ * one at a time.
+ *
+ * Since: 1.4
+ */
+void
+graphene_euler_to_matrix_array (unsigned int           n_eulers,
+                                const graphene_euler_t e[],
+                                graphene_matrix_t      res[])
+{
+  const graphene_simd4f_t zero = graphene_simd4f_init_zero ();
+  const graphene_simd4f_t unit_w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  unsigned int i;
+
+  for (i = 0; i < n_eulers; i += 4)
+    {
+      unsigned int n = MIN (n_eulers - i, 4);
+      graphene_euler_order_t order;
+      graphene_simd4f_t x, y, z, m[9];
+      graphene_simd4f_t c1, s1, c2, s2, c3, s3;
+      graphene_simd4f_t c3c2, s3c1, c3s2s1, s3s1;
+      graphene_simd4f_t c3s2c1, s3c2, c3c1, s3s2s1;
+      graphene_simd4f_t c3s1, s3s2c1, c2s1, c2c1;
+      graphene_simd4x4f_t rows;
+      unsigned int j;
+
+      order = euler_load_soa (e + i, n, &x, &y, &z);
+      if (order == GRAPHENE_EULER_ORDER_DEFAULT)
+        {
+          for (j = 0; j < n; j++)
+            graphene_euler_to_matrix (&e[i + j], &res[i + j]);
+
+          continue;
+        }
+
+      /* same names, and same formulas, as graphene_euler_to_matrix() */
+      euler_simd_sincos (x, &c1, &s1);
+      euler_simd_sincos (y, &c2, &s2);
+      euler_simd_sincos (z, &c3, &s3);
+
+      c3c2 = graphene_simd4f_mul (c3, c2);
+      s3c1 = graphene_simd4f_mul (s3, c1);
+      c3s2s1 = graphene_simd4f_mul (graphene_simd4f_mul (c3, s2), s1);
+      s3s1 = graphene_simd4f_mul (s3, s1);
+      c3s2c1 = graphene_simd4f_mul (graphene_simd4f_mul (c3, s2), c1);
+      s3c2 = graphene_simd4f_mul (s3, c2);
+      c3c1 = graphene_simd4f_mul (c3, c1);
+      s3s2s1 = graphene_simd4f_mul (graphene_simd4f_mul (s3, s2), s1);
+      c3s1 = graphene_simd4f_mul (c3, s1);
+      s3s2c1 = graphene_simd4f_mul (graphene_simd4f_mul (s3, s2), c1);
+      c2s1 = graphene_simd4f_mul (c2, s1);
+      c2c1 = graphene_simd4f_mul (c2, c1);
+
+      switch (order)
+        {
+        case GRAPHENE_EULER_ORDER_XYZ:
+          m[0] = c3c2;
+          m[1] = graphene_simd4f_add (s3c1, c3s2s1);
+          m[2] = graphene_simd4f_sub (s3s1, c3s2c1);
+          m[3] = graphene_simd4f_neg (s3c2);
+          m[4] = graphene_simd4f_sub (c3c1, s3s2s1);
+          m[5] = graphene_simd4f_add (c3s1, s3s2c1);
+          m[6] = s2;
+          m[7] = graphene_simd4f_neg (c2s1);
+          m[8] = c2c1;
+          break;
+
+        case GRAPHENE_EULER_ORDER_YXZ:
+          m[0] = graphene_simd4f_add (c3c1, s3s2s1);
+          m[1] = s3c2;
+          m[2] = graphene_simd4f_sub (s3s2c1, c3s1);
+          m[3] = graphene_simd4f_sub (c3s2s1, s3c1);
+          m[4] = c3c2;
+          m[5] = graphene_simd4f_add (s3s1, c3s2c1);
+          m[6] = c2s1;
+          m[7] = graphene_simd4f_neg (s2);
+          m[8] = c2c1;
+          break;
+
+        case GRAPHENE_EULER_ORDER_ZXY:
+          m[0] = graphene_simd4f_sub (c3c1, s3s2s1);
+          m[1] = graphene_simd4f_add (c3s1, s3s2c1);
+          m[2] = graphene_simd4f_neg (s3c2);
+          m[3] = graphene_simd4f_neg (c2s1);
+          m[4] = c2c1;
+          m[5] = s2;
+          m[6] = graphene_simd4f_add (s3c1, c3s2s1);
+          m[7] = graphene_simd4f_sub (s3s1, c3s2c1);
+          m[8] = c3c2;
+          break;
+
+        case GRAPHENE_EULER_ORDER_ZYX:
+          m[0] = c2c1;
+          m[1] = c2s1;
+          m[2] = graphene_simd4f_neg (s2);
+          m[3] = graphene_simd4f_sub (s3s2c1, c3s1);
+          m[4] = graphene_simd4f_add (s3s2s1, c3c1);
+          m[5] = s3c2;
+          m[6] = graphene_simd4f_add (c3s2c1, s3s1);
+          m[7] = graphene_simd4f_sub (c3s2s1, s3c1);
+          m[8] = c3c2;
+          break;
+
+        case GRAPHENE_EULER_ORDER_YZX:
+          m[0] = c2c1;
+          m[1] = s2;
+          m[2] = graphene_simd4f_neg (c2s1);
+          m[3] = graphene_simd4f_sub (s3s1, c3s2c1);
+          m[4] = c3c2;
+          m[5] = graphene_simd4f_add (c3s2s1, s3c1);
+          m[6] = graphene_simd4f_add (s3s2c1, c3s1);
+          m[7] = graphene_simd4f_neg (s3c2);
+          m[8] = graphene_simd4f_sub (c3c1, s3s2s1);
+          break;
+
+        case GRAPHENE_EULER_ORDER_XZY:
+          m[0] = c3c2;
+          m[1] = graphene_simd4f_add (c3s2c1, s3s1);
+          m[2] = graphene_simd4f_sub (c3s2s1, s3c1);
+          m[3] = graphene_simd4f_neg (s2);
+          m[4] = c2c1;
+          m[5] = c2s1;
+          m[6] = s3c2;
+          m[7] = graphene_simd4f_sub (s3s2c1, c3s1);
+          m[8] = graphene_simd4f_add (s3s2s1, c3c1);
+          break;
+
+        case GRAPHENE_EULER_ORDER_DEFAULT:
+        default:
+          m[0] = m[4] = m[8] = graphene_simd4f_splat (1.f);
+          m[1] = m[2] = m[3] = m[5] = m[6] = m[7] = zero;
+          break;
+        }
+
+      /* transposing each row of elements yields the same
+       * row of the four matrices
+       */
+      for (j = 0; j < 3; j++)
+        {
+          rows = graphene_simd4x4f_init (m[j * 3 + 0], m[j * 3 + 1], m[j * 3 + 2], zero);
+          graphene_simd4x4f_transpose_in_place (&rows);
+
+          switch (j)
+            {
+            case 0:
+              res[i].value.x = rows.x;
+              if (n > 1) res[i + 1].value.x = rows.y;
+              if (n > 2) res[i + 2].value.x = rows.z;
+              if (n > 3) res[i + 3].value.x = rows.w;
+              break;
+
+            case 1:
+              res[i].value.y = rows.x;
+              if (n > 1) res[i + 1].value.y = rows.y;
+              if (n > 2) res[i + 2].value.y = rows.z;
+              if (n > 3) res[i + 3].value.y = rows.w;
+              break;
+
+            default:
+              res[i].value.z = rows.x;
+              if (n > 1) res[i + 1].value.z = rows.y;
+              if (n > 2) res[i + 2].value.z = rows.z;
+              if (n > 3) res[i + 3].value.z = rows.w;
+              break;
+            }
+        }
+
+      for (j = 0; j < n; j++)
+        res[i + j].value.w = unit_w;
+    }
+}
+
+/**
+ * graphene_euler_to_quaternion_array:
+ * @n_eulers: the number of #graphene_euler_t
+ * @e: (array length=n_eulers): an array of #graphene_euler_t
+ * @res: (array length=n_eulers) (out caller-allocates): return location
+ *   for the quaternions
+ *
+ * Converts each #graphene_euler_t in the @e array into a quaternion;
+ * see graphene_quaternion_init_from_euler().
+ *
+ * The elements are converted four at a time, computing the sine and
+ * cosine of all their angles at once. Consecutive elements should use
+ * the same order of rotations; four elements that do not are converted
+ * one at a time.
+ *
+ * Since: 1.4
+ */
+void
+graphene_euler_to_quaternion_array (unsigned int           n_eulers,
+                                    const graphene_euler_t e[],
+                                    graphene_quaternion_t  res[])
+{
+  const graphene_simd4f_t half = graphene_simd4f_splat (0.5f);
+  unsigned int i;
+
+  for (i = 0; i < n_eulers; i += 4)
+    {
+      unsigned int n = MIN (n_eulers - i, 4);
+      graphene_euler_order_t order;
+      graphene_simd4f_t x, y, z;
+      graphene_simd4f_t c1, c2, c3, s1, s2, s3;
+      graphene_simd4f_t s1c2c3, c1s2s3, c1s2c3, s1c2s3;
+      graphene_simd4f_t c1c2s3, s1s2c3, c1c2c3, s1s2s3;
+      float sign[4];
+      graphene_simd4x4f_t q;
+      unsigned int j;
+
+      order = euler_load_soa (e + i, n, &x, &y, &z);
+      if (order == GRAPHENE_EULER_ORDER_DEFAULT)
+        {
+          for (j = 0; j < n; j++)
+            graphene_quaternion_init_from_euler (&res[i + j], &e[i + j]);
+
+          continue;
+        }
+
+      euler_simd_sincos (graphene_simd4f_mul (x, half), &s1, &c1);
+      euler_simd_sincos (graphene_simd4f_mul (y, half), &s2, &c2);
+      euler_simd_sincos (graphene_simd4f_mul (z, half), &s3, &c3);
+
+      s1c2c3 = graphene_simd4f_mul (graphene_simd4f_mul (s1, c2), c3);
+      c1s2s3 = graphene_simd4f_mul (graphene_simd4f_mul (c1, s2), s3);
+      c1s2c3 = graphene_simd4f_mul (graphene_simd4f_mul (c1, s2), c3);
+      s1c2s3 = graphene_simd4f_mul (graphene_simd4f_mul (s1, c2), s3);
+      c1c2s3 = graphene_simd4f_mul (graphene_simd4f_mul (c1, c2), s3);
+      s1s2c3 = graphene_simd4f_mul (graphene_simd4f_mul (s1, s2), c3);
+      c1c2c3 = graphene_simd4f_mul (graphene_simd4f_mul (c1, c2), c3);
+      s1s2s3 = graphene_simd4f_mul (graphene_simd4f_mul (s1, s2), s3);
+
+      /* every order uses the same terms, and only changes the
+       * sign of the second term of each component
+       */
+      switch (order)
+        {
+        case GRAPHENE_EULER_ORDER_XYZ:
+          sign[0] = 1.f; sign[1] = -1.f; sign[2] = 1.f; sign[3] = -1.f;
+          break;
+
+        case GRAPHENE_EULER_ORDER_YXZ:
+          sign[0] = 1.f; sign[1] = -1.f; sign[2] = -1.f; sign[3] = 1.f;
+          break;
+
+        case GRAPHENE_EULER_ORDER_ZXY:
+          sign[0] = -1.f; sign[1] = 1.f; sign[2] = 1.f; sign[3] = -1.f;
+          break;
+
+        case GRAPHENE_EULER_ORDER_ZYX:
+          sign[0] = -1.f; sign[1] = 1.f; sign[2] = -1.f; sign[3] = 1.f;
+          break;
+
+        case GRAPHENE_EULER_ORDER_YZX:
+          sign[0] = 1.f; sign[1] = 1.f; sign[2] = -1.f; sign[3] = -1.f;
+          break;
+
+        case GRAPHENE_EULER_ORDER_XZY:
+        case GRAPHENE_EULER_ORDER_DEFAULT:
+        default:
+          sign[0] = -1.f; sign[1] = -1.f; sign[2] = 1.f; sign[3] = 1.f;
+          break;
+        }
+
+      q.x = graphene_simd4f_madd (c1s2s3, graphene_simd4f_splat (sign[0]), s1c2c3);
+      q.y = graphene_simd4f_madd (s1c2s3, graphene_simd4f_splat (sign[1]), c1s2c3);
+      q.z = graphene_simd4f_madd (s1s2c3, graphene_simd4f_splat (sign[2]), c1c2s3);
+      q.w = graphene_simd4f_madd (s1s2s3, graphene_simd4f_splat (sign[3]), c1c2c3);
+
+      graphene_simd4x4f_transpose_in_place (&q);
+
+      graphene_quaternion_store (q.x, &res[i]);
+      if (n > 1)
+        graphene_quaternion_store (q.y, &res[i + 1]);
+      if (n > 2)
+        graphene_quaternion_store (q.z, &res[i + 2]);
+      if (n > 3)
+        graphene_quaternion_store (q.w, &res[i + 3]);
+    }
+}
+
+/* each order extracts the middle angle from the arc sine of a single
+ * element, and the other two angles from the arc tangents of two pairs
+ * of elements; when the middle angle is ±π/2, one of the two angles is
+ * computed from a third pair, and the other one is set to 0. The terms
+ * refer to the elements of the rotation matrix in row-major order, from
+ * m11 (0) to m33 (8); see graphene_euler_init_from_matrix()
+ */
+typedef struct {
+  unsigned char axis;
+  unsigned char y, x;
+  float sign;
+} euler_matrix_term_t;
+
+static const euler_matrix_term_t euler_matrix_terms[6][4] = {
+  /* GRAPHENE_EULER_ORDER_XYZ */
+  { { 1, 2, 0,  1.f }, { 0, 5, 8, -1.f }, { 2, 1, 0, -1.f }, { 0, 7, 4,  1.f } },
+  /* GRAPHENE_EULER_ORDER_YZX */
+  { { 2, 3, 0,  1.f }, { 0, 5, 4, -1.f }, { 1, 6, 0, -1.f }, { 1, 2, 8,  1.f } },
+  /* GRAPHENE_EULER_ORDER_ZXY */
+  { { 0, 7, 0,  1.f }, { 1, 6, 8, -1.f }, { 2, 1, 4, -1.f }, { 2, 3, 0,  1.f } },
+  /* GRAPHENE_EULER_ORDER_XZY */
+  { { 2, 1, 0, -1.f }, { 0, 7, 4,  1.f }, { 1, 2, 0,  1.f }, { 0, 5, 8, -1.f } },
+  /* GRAPHENE_EULER_ORDER_YXZ */
+  { { 0, 5, 0, -1.f }, { 1, 2, 8,  1.f }, { 2, 3, 4,  1.f }, { 1, 6, 0, -1.f } },
+  /* GRAPHENE_EULER_ORDER_ZYX */
+  { { 1, 6, 0, -1.f }, { 0, 7, 8,  1.f }, { 2, 3, 0,  1.f }, { 2, 1, 4, -1.f } },
+};
+
+/**
+ * graphene_euler_init_from_matrix_array:
+ * @n_matrices: the number of matrices
+ * @m: (array length=n_matrices): an array of rotation matrices
+ * @order: the order used to apply the rotations
+ * @res: (array length=n_matrices) (out caller-allocates): return location
+ *   for the #graphene_euler_t
+ *
+ * Initializes each #graphene_euler_t in the @res array using the
+ * corresponding rotation matrix in the @m array; see
+ * graphene_euler_init_from_matrix().
+ *
+ * The matrices are converted four at a time, reading the rotation
+ * components directly from their rows, and computing the arc tangents
+ * of all the angles at once.
+ *
+ * Since: 1.4
+ */
+void
+graphene_euler_init_from_matrix_array (unsigned int            n_matrices,
+                                       const graphene_matrix_t m[],
+                                       graphene_euler_order_t  order,
+                                       graphene_euler_t        res[])
+{
+  const graphene_simd4f_t zero = graphene_simd4f_init_zero ();
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  const euler_matrix_term_t *terms;
+  graphene_euler_t tmp;
+  unsigned int i;
+
+  tmp.order = order;
+  terms = euler_matrix_terms[graphene_euler_get_order (&tmp)];
+
+  for (i = 0; i < n_matrices; i += 4)
+    {
+      unsigned int n = MIN (n_matrices - i, 4);
+      const graphene_matrix_t *m1 = n > 1 ? &m[i + 1] : &m[i];
+      const graphene_matrix_t *m2 = n > 2 ? &m[i + 2] : &m[i];
+      const graphene_matrix_t *m3 = n > 3 ? &m[i + 3] : &m[i];
+      graphene_simd4x4f_t rows, angles;
+      graphene_simd4f_t el[9], a[3];
+      graphene_simd4f_t s, regular, gimbal, locked;
+      float s_v[4], regular_v[4];
+      unsigned int j;
+
+      /* the rows of four matrices, transposed, give each element
+       * of the rotation components for all of them
+       */
+      rows = graphene_simd4x4f_init (m[i].value.x, m1->value.x, m2->value.x, m3->value.x);
+      graphene_simd4x4f_transpose_in_place (&rows);
+      el[0] = rows.x; el[1] = rows.y; el[2] = rows.z;
+
+      rows = graphene_simd4x4f_init (m[i].value.y, m1->value.y, m2->value.y, m3->value.y);
+      graphene_simd4x4f_transpose_in_place (&rows);
+      el[3] = rows.x; el[4] = rows.y; el[5] = rows.z;
+
+      rows = graphene_simd4x4f_init (m[i].value.z, m1->value.z, m2->value.z, m3->value.z);
+      graphene_simd4x4f_transpose_in_place (&rows);
+      el[6] = rows.x; el[7] = rows.y; el[8] = rows.z;
+
+      /* the middle angle */
+      s = graphene_simd4f_mul (el[terms[0].y], graphene_simd4f_splat (terms[0].sign));
+      s = graphene_simd4f_max (s, graphene_simd4f_neg (one));
+      s = graphene_simd4f_min (s, one);
+      a[terms[0].axis] =
+        euler_simd_atan2 (s, graphene_simd4f_sqrt (graphene_simd4f_max (graphene_simd4f_mul (graphene_simd4f_sub (one, s),
+                                                                                             graphene_simd4f_add (one, s)),
+                                                                         zero)));
+
+      /* the angle computed from the third pair in case of gimbal lock */
+      gimbal = euler_simd_atan2 (graphene_simd4f_mul (el[terms[3].y], graphene_simd4f_splat (terms[3].sign)),
+                                 el[terms[3].x]);
+
+      graphene_simd4f_dup_4f (s, s_v);
+      for (j = 0; j < 4; j++)
+        regular_v[j] = fabsf (s_v[j]) < 1.f ? 1.f : 0.f;
+      regular = graphene_simd4f_init_4f (regular_v);
+
+      for (j = 1; j < 3; j++)
+        {
+          graphene_simd4f_t angle =
+            euler_simd_atan2 (graphene_simd4f_mul (el[terms[j].y], graphene_simd4f_splat (terms[j].sign)),
+                              el[terms[j].x]);
+
+          locked = terms[j].axis == terms[3].axis ? gimbal : zero;
+          a[terms[j].axis] = graphene_simd4f_madd (regular, graphene_simd4f_sub (angle, locked), locked);
+        }
+
+      angles = graphene_simd4x4f_init (a[0], a[1], a[2], zero);
+      graphene_simd4x4f_transpose_in_place (&angles);
+
+      res[i].angles.value = angles.x;
+      res[i].order = order;
+      if (n > 1)
+        {
+          res[i + 1].angles.value = angles.y;
+          res[i + 1].order = order;
+        }
+      if (n > 2)
+        {
+          res[i + 2].angles.value = angles.z;
+          res[i + 2].order = order;
+        }
+      if (n > 3)
+        {
+          res[i + 3].angles.value = angles.w;
+          res[i + 3].order = order;
+        }
+    }
+}
+
 /**
  * graphene_euler_reorder:
  * @e: a #graphene_euler_t
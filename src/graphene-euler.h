@@ -29,6 +29,8 @@
 #endif
 
 #include "graphene-types.h"
+#include "graphene-matrix.h"
+#include "graphene-quaternion.h"
 #include "graphene-vec3.h"
 
 GRAPHENE_BEGIN_DECLS
@@ -135,6 +137,20 @@ void                    graphene_euler_reorder                  (const graphene_
                                                                  graphene_euler_order_t       order,
                                                                  graphene_euler_t            *res);
 
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_euler_to_matrix_array          (unsigned int                 n_eulers,
+                                                                 const graphene_euler_t       e[],
+                                                                 graphene_matrix_t            res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_euler_to_quaternion_array      (unsigned int                 n_eulers,
+                                                                 const graphene_euler_t       e[],
+                                                                 graphene_quaternion_t        res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_euler_init_from_matrix_array   (unsigned int                 n_matrices,
+                                                                 const graphene_matrix_t      m[],
+                                                                 graphene_euler_order_t       order,
+                                                                 graphene_euler_t             res[]);
+
 GRAPHENE_END_DECLS
 
 #endif /* __GRAPHENE_EULER_H__ */
@@ -156,10 +156,14 @@ GRAPHENE_DEFINE_BOXED_TYPE (GrapheneVec4, graphene_vec4)
 
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneQuad, graphene_quad)
 
+GRAPHENE_DEFINE_BOXED_TYPE (GraphenePreparedQuad, graphene_prepared_quad)
+
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneQuaternion, graphene_quaternion)
 
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneMatrix, graphene_matrix)
 
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneMatrix3x4, graphene_matrix3x4)
+
 GRAPHENE_DEFINE_BOXED_TYPE (GraphenePlane, graphene_plane)
 
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneFrustum, graphene_frustum)
@@ -173,3 +177,11 @@ GRAPHENE_DEFINE_BOXED_TYPE (GrapheneTriangle, graphene_triangle)
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneEuler, graphene_euler)
 
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneRay, graphene_ray)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GraphenePolygon, graphene_polygon)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneLineSegment, graphene_line_segment)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneDualQuaternion, graphene_dual_quaternion)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneUnprojector, graphene_unprojector)
@@ -114,6 +114,36 @@ GType graphene_euler_get_type (void);
 GRAPHENE_AVAILABLE_IN_1_4
 GType graphene_ray_get_type (void);
 
+#define GRAPHENE_TYPE_POLYGON           (graphene_polygon_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_4
+GType graphene_polygon_get_type (void);
+
+#define GRAPHENE_TYPE_LINE_SEGMENT      (graphene_line_segment_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_4
+GType graphene_line_segment_get_type (void);
+
+#define GRAPHENE_TYPE_DUAL_QUATERNION   (graphene_dual_quaternion_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_4
+GType graphene_dual_quaternion_get_type (void);
+
+#define GRAPHENE_TYPE_PREPARED_QUAD     (graphene_prepared_quad_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_4
+GType graphene_prepared_quad_get_type (void);
+
+#define GRAPHENE_TYPE_MATRIX3X4         (graphene_matrix3x4_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_4
+GType graphene_matrix3x4_get_type (void);
+
+#define GRAPHENE_TYPE_UNPROJECTOR       (graphene_unprojector_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_4
+GType graphene_unprojector_get_type (void);
+
 G_END_DECLS
 
 #endif /* __GRAPHENE_GOBJECT_H__ */
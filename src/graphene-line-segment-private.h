@@ -26,32 +26,30 @@
 
 #include "graphene-point.h"
 
-typedef struct {
-  graphene_point_t start;
-  graphene_point_t end;
-} graphene_line_segment_t;
-
-static inline graphene_line_segment_t
-graphene_line_segment_init (const graphene_point_t *start,
-                            const graphene_point_t *end)
-{
-  graphene_line_segment_t l;
-  l.start = *start;
-  l.end = *end;
-
-  return l;
-}
-
+/*< private >
+ * graphene_line_segment_points_on_same_side_internal:
+ * @start: the start point of the segment
+ * @end: the end point of the segment
+ * @a: a #graphene_point_t
+ * @b: a #graphene_point_t
+ *
+ * Checks whether @a and @b lie on the same side of the line passing
+ * through @start and @end; points on the line are on both sides.
+ *
+ * This is the inline version of graphene_line_segment_points_on_same_side(),
+ * for the hot paths inside the library.
+ */
 static inline bool
-graphene_line_segment_points_on_same_side (graphene_line_segment_t  s,
-                                           const graphene_point_t  *a,
-                                           const graphene_point_t  *b)
+graphene_line_segment_points_on_same_side_internal (const graphene_point_t *start,
+                                                    const graphene_point_t *end,
+                                                    const graphene_point_t *a,
+                                                    const graphene_point_t *b)
 {
-  const float delta_x = (s.end.x - s.start.x);
-  const float delta_y = (s.end.y - s.start.y);
+  const float delta_x = (end->x - start->x);
+  const float delta_y = (end->y - start->y);
 
-  const float one = delta_x * (a->y - s.start.y) - delta_y * (a->x - s.start.x);
-  const float two = delta_x * (b->y - s.start.y) - delta_y * (b->x - s.start.x);
+  const float one = delta_x * (a->y - start->y) - delta_y * (a->x - start->x);
+  const float two = delta_x * (b->y - start->y) - delta_y * (b->x - start->x);
 
   if ((one >= 0.f && two >= 0.f) || (one <= 0.f && two <= 0.f))
     return true;
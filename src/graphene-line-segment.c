@@ -0,0 +1,445 @@
+/* graphene-line-segment.c: Segments
+ *
+ * Copyright © 2014  Emmanuele Bassi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-line-segment
+ * @Title: Line segment
+ * @Short_Description: A segment between two points
+ *
+ * #graphene_line_segment_t represents the segment between two
+ * #graphene_point_t.
+ *
+ * Besides the functions operating on a single segment, there are batch
+ * functions testing one segment against an array of segments or points;
+ * these process four elements per iteration.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-line-segment.h"
+
+#include "graphene-line-segment-private.h"
+#include "graphene-simd4f.h"
+
+#include <math.h>
+
+/**
+ * graphene_line_segment_alloc: (constructor)
+ *
+ * Allocates a new #graphene_line_segment_t.
+ *
+ * The contents of the returned structure are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_line_segment_t.
+ *   Use graphene_line_segment_free() to free the resources allocated by
+ *   this function
+ *
+ * Since: 1.4
+ */
+graphene_line_segment_t *
+graphene_line_segment_alloc (void)
+{
+  return calloc (1, sizeof (graphene_line_segment_t));
+}
+
+/**
+ * graphene_line_segment_free:
+ * @s: a #graphene_line_segment_t
+ *
+ * Frees the resources allocated by graphene_line_segment_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_line_segment_free (graphene_line_segment_t *s)
+{
+  free (s);
+}
+
+/**
+ * graphene_line_segment_init:
+ * @s: the #graphene_line_segment_t to initialize
+ * @start: the start of the segment
+ * @end: the end of the segment
+ *
+ * Initializes a #graphene_line_segment_t using the given points.
+ *
+ * Returns: (transfer none): the initialized #graphene_line_segment_t
+ *
+ * Since: 1.4
+ */
+graphene_line_segment_t *
+graphene_line_segment_init (graphene_line_segment_t *s,
+                            const graphene_point_t  *start,
+                            const graphene_point_t  *end)
+{
+  s->start = *start;
+  s->end = *end;
+
+  return s;
+}
+
+/**
+ * graphene_line_segment_get_start:
+ * @s: a #graphene_line_segment_t
+ * @start: (out caller-allocates): return location for the start point
+ *
+ * Retrieves the start point of the segment.
+ *
+ * Since: 1.4
+ */
+void
+graphene_line_segment_get_start (const graphene_line_segment_t *s,
+                                 graphene_point_t              *start)
+{
+  *start = s->start;
+}
+
+/**
+ * graphene_line_segment_get_end:
+ * @s: a #graphene_line_segment_t
+ * @end: (out caller-allocates): return location for the end point
+ *
+ * Retrieves the end point of the segment.
+ *
+ * Since: 1.4
+ */
+void
+graphene_line_segment_get_end (const graphene_line_segment_t *s,
+                               graphene_point_t              *end)
+{
+  *end = s->end;
+}
+
+/**
+ * graphene_line_segment_points_on_same_side:
+ * @s: a #graphene_line_segment_t
+ * @a: a #graphene_point_t
+ * @b: a #graphene_point_t
+ *
+ * Checks whether the two points @a and @b lie on the same side of
+ * the line passing through the segment @s.
+ *
+ * Points lying on the line are considered to be on both sides.
+ *
+ * Returns: `true` if the points are on the same side
+ *
+ * Since: 1.4
+ */
+bool
+graphene_line_segment_points_on_same_side (const graphene_line_segment_t *s,
+                                           const graphene_point_t        *a,
+                                           const graphene_point_t        *b)
+{
+  return graphene_line_segment_points_on_same_side_internal (&s->start, &s->end, a, b);
+}
+
+static inline float
+cross2 (float a_x, float a_y,
+        float b_x, float b_y)
+{
+  return a_x * b_y - a_y * b_x;
+}
+
+/**
+ * graphene_line_segment_intersection:
+ * @a: a #graphene_line_segment_t
+ * @b: a #graphene_line_segment_t
+ * @res: (out caller-allocates) (optional): return location for the
+ *   intersection point, or %NULL
+ *
+ * Checks whether the two segments intersect and, if they do, computes
+ * the intersection point.
+ *
+ * If the segments are collinear and overlap, the intersection point is
+ * the point of the overlap closest to the start of @a.
+ *
+ * Returns: `true` if the segments intersect
+ *
+ * Since: 1.4
+ */
+bool
+graphene_line_segment_intersection (const graphene_line_segment_t *a,
+                                    const graphene_line_segment_t *b,
+                                    graphene_point_t              *res)
+{
+  float r_x, r_y, s_x, s_y, qp_x, qp_y;
+  float denom, t_num, u_num, t, len2, t_0, t_1;
+
+  r_x = a->end.x - a->start.x;
+  r_y = a->end.y - a->start.y;
+  s_x = b->end.x - b->start.x;
+  s_y = b->end.y - b->start.y;
+  qp_x = b->start.x - a->start.x;
+  qp_y = b->start.y - a->start.y;
+
+  denom = cross2 (r_x, r_y, s_x, s_y);
+  t_num = cross2 (qp_x, qp_y, s_x, s_y);
+  u_num = cross2 (qp_x, qp_y, r_x, r_y);
+
+  if (denom != 0.f)
+    {
+      float u;
+
+      t = t_num / denom;
+      u = u_num / denom;
+
+      if (t < 0.f || t > 1.f || u < 0.f || u > 1.f)
+        return false;
+    }
+  else
+    {
+      /* parallel, but not collinear */
+      if (u_num != 0.f || t_num != 0.f)
+        return false;
+
+      len2 = r_x * r_x + r_y * r_y;
+      if (len2 == 0.f)
+        {
+          /* @a is a point lying on the line of @b */
+          len2 = s_x * s_x + s_y * s_y;
+          if (len2 == 0.f)
+            t = (qp_x == 0.f && qp_y == 0.f) ? 0.f : -1.f;
+          else
+            t = -(qp_x * s_x + qp_y * s_y) / len2;
+
+          if (t < 0.f || t > 1.f)
+            return false;
+
+          if (res != NULL)
+            *res = a->start;
+
+          return true;
+        }
+
+      /* project @b on @a, and check whether the ranges overlap */
+      t_0 = (qp_x * r_x + qp_y * r_y) / len2;
+      t_1 = t_0 + (s_x * r_x + s_y * r_y) / len2;
+
+      if (t_0 > t_1)
+        {
+          t = t_0;
+          t_0 = t_1;
+          t_1 = t;
+        }
+
+      if (t_1 < 0.f || t_0 > 1.f)
+        return false;
+
+      t = MAX (t_0, 0.f);
+    }
+
+  if (res != NULL)
+    graphene_point_init (res, a->start.x + r_x * t, a->start.y + r_y * t);
+
+  return true;
+}
+
+/**
+ * graphene_line_segment_get_closest_point:
+ * @s: a #graphene_line_segment_t
+ * @p: a #graphene_point_t
+ * @res: (out caller-allocates): return location for the closest point
+ *
+ * Computes the point on the segment @s closest to the given point @p.
+ *
+ * Since: 1.4
+ */
+void
+graphene_line_segment_get_closest_point (const graphene_line_segment_t *s,
+                                         const graphene_point_t        *p,
+                                         graphene_point_t              *res)
+{
+  const float d_x = s->end.x - s->start.x;
+  const float d_y = s->end.y - s->start.y;
+  const float len2 = d_x * d_x + d_y * d_y;
+  float t = 0.f;
+
+  if (len2 > 0.f)
+    t = CLAMP (((p->x - s->start.x) * d_x + (p->y - s->start.y) * d_y) / len2, 0.f, 1.f);
+
+  graphene_point_init (res, s->start.x + d_x * t, s->start.y + d_y * t);
+}
+
+/**
+ * graphene_line_segment_get_distance_to_point:
+ * @s: a #graphene_line_segment_t
+ * @p: a #graphene_point_t
+ *
+ * Computes the distance between the segment @s and the given point @p.
+ *
+ * Returns: the distance
+ *
+ * Since: 1.4
+ */
+float
+graphene_line_segment_get_distance_to_point (const graphene_line_segment_t *s,
+                                             const graphene_point_t        *p)
+{
+  graphene_point_t c;
+
+  graphene_line_segment_get_closest_point (s, p, &c);
+
+  return graphene_point_distance (&c, p, NULL, NULL);
+}
+
+/**
+ * graphene_line_segment_intersect_segments:
+ * @s: a #graphene_line_segment_t
+ * @n_segments: the number of segments in @segments
+ * @segments: (array length=n_segments): an array of #graphene_line_segment_t
+ * @res: (array length=n_segments) (out caller-allocates): return location
+ *   for the result of the intersection test with each segment
+ *
+ * Checks whether @s intersects each of the given @segments; the
+ * result of each test is the same as graphene_line_segment_intersection().
+ *
+ * The segments are tested four at a time; the intersection parameters
+ * are compared against the range of each segment without dividing by
+ * the determinant, and only parallel segments fall back to the
+ * scalar test.
+ *
+ * Returns: the number of segments intersecting @s
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_line_segment_intersect_segments (const graphene_line_segment_t *s,
+                                          unsigned int                   n_segments,
+                                          const graphene_line_segment_t  segments[],
+                                          bool                           res[])
+{
+  const graphene_simd4f_t p_x = graphene_simd4f_splat (s->start.x);
+  const graphene_simd4f_t p_y = graphene_simd4f_splat (s->start.y);
+  const graphene_simd4f_t r_x = graphene_simd4f_splat (s->end.x - s->start.x);
+  const graphene_simd4f_t r_y = graphene_simd4f_splat (s->end.y - s->start.y);
+  unsigned int i, j, n_hits = 0;
+
+  for (i = 0; i + 4 <= n_segments; i += 4)
+    {
+      const graphene_line_segment_t *b = &segments[i];
+      graphene_simd4f_t q_x, q_y, s_x, s_y, qp_x, qp_y;
+      graphene_simd4f_t denom, denom2, t, u, c_t, c_u, c;
+      float d2[4], v[4];
+
+      q_x = graphene_simd4f_init (b[0].start.x, b[1].start.x, b[2].start.x, b[3].start.x);
+      q_y = graphene_simd4f_init (b[0].start.y, b[1].start.y, b[2].start.y, b[3].start.y);
+      s_x = graphene_simd4f_sub (graphene_simd4f_init (b[0].end.x, b[1].end.x, b[2].end.x, b[3].end.x), q_x);
+      s_y = graphene_simd4f_sub (graphene_simd4f_init (b[0].end.y, b[1].end.y, b[2].end.y, b[3].end.y), q_y);
+      qp_x = graphene_simd4f_sub (q_x, p_x);
+      qp_y = graphene_simd4f_sub (q_y, p_y);
+
+      denom = graphene_simd4f_sub (graphene_simd4f_mul (r_x, s_y), graphene_simd4f_mul (r_y, s_x));
+      denom2 = graphene_simd4f_mul (denom, denom);
+
+      /* t = t_num / denom is in [0, 1] iff t_num * denom is in [0, denom²],
+       * which avoids both the division and a per-lane sign test
+       */
+      t = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_mul (qp_x, s_y),
+                                                    graphene_simd4f_mul (qp_y, s_x)),
+                               denom);
+      u = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_mul (qp_x, r_y),
+                                                    graphene_simd4f_mul (qp_y, r_x)),
+                               denom);
+
+      c_t = graphene_simd4f_min (t, graphene_simd4f_sub (denom2, t));
+      c_u = graphene_simd4f_min (u, graphene_simd4f_sub (denom2, u));
+      c = graphene_simd4f_min (c_t, c_u);
+
+      graphene_simd4f_dup_4f (denom2, d2);
+      graphene_simd4f_dup_4f (c, v);
+
+      for (j = 0; j < 4; j++)
+        {
+          if (d2[j] > 0.f)
+            res[i + j] = v[j] >= 0.f;
+          else
+            res[i + j] = graphene_line_segment_intersection (s, &b[j], NULL);
+
+          n_hits += res[i + j] ? 1 : 0;
+        }
+    }
+
+  for (; i < n_segments; i++)
+    {
+      res[i] = graphene_line_segment_intersection (s, &segments[i], NULL);
+      n_hits += res[i] ? 1 : 0;
+    }
+
+  return n_hits;
+}
+
+/**
+ * graphene_line_segment_get_distances_to_points:
+ * @s: a #graphene_line_segment_t
+ * @n_points: the number of points in @points
+ * @points: (array length=n_points): an array of #graphene_point_t
+ * @res: (array length=n_points) (out caller-allocates): return location
+ *   for the distance of each point from the segment
+ *
+ * Computes the distance between @s and each of the given @points,
+ * four points at a time.
+ *
+ * Since: 1.4
+ */
+void
+graphene_line_segment_get_distances_to_points (const graphene_line_segment_t *s,
+                                               unsigned int                   n_points,
+                                               const graphene_point_t         points[],
+                                               float                          res[])
+{
+  const float d_x = s->end.x - s->start.x;
+  const float d_y = s->end.y - s->start.y;
+  const float len2 = d_x * d_x + d_y * d_y;
+  const graphene_simd4f_t a_x = graphene_simd4f_splat (s->start.x);
+  const graphene_simd4f_t a_y = graphene_simd4f_splat (s->start.y);
+  const graphene_simd4f_t v_x = graphene_simd4f_splat (d_x);
+  const graphene_simd4f_t v_y = graphene_simd4f_splat (d_y);
+  const graphene_simd4f_t inv_len2 = graphene_simd4f_splat (len2 > 0.f ? 1.f / len2 : 0.f);
+  const graphene_simd4f_t zero = graphene_simd4f_splat (0.f);
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  unsigned int i;
+
+  for (i = 0; i + 4 <= n_points; i += 4)
+    {
+      const graphene_point_t *p = &points[i];
+      graphene_simd4f_t e_x, e_y, t, d;
+
+      e_x = graphene_simd4f_sub (graphene_simd4f_init (p[0].x, p[1].x, p[2].x, p[3].x), a_x);
+      e_y = graphene_simd4f_sub (graphene_simd4f_init (p[0].y, p[1].y, p[2].y, p[3].y), a_y);
+
+      /* the projection on the segment, clamped to its ends */
+      t = graphene_simd4f_mul (graphene_simd4f_madd (e_x, v_x, graphene_simd4f_mul (e_y, v_y)), inv_len2);
+      t = graphene_simd4f_min (t, one);
+      t = graphene_simd4f_max (zero, t);
+
+      e_x = graphene_simd4f_sub (e_x, graphene_simd4f_mul (v_x, t));
+      e_y = graphene_simd4f_sub (e_y, graphene_simd4f_mul (v_y, t));
+
+      d = graphene_simd4f_sqrt (graphene_simd4f_madd (e_x, e_x, graphene_simd4f_mul (e_y, e_y)));
+      graphene_simd4f_dup_4f (d, res + i);
+    }
+
+  for (; i < n_points; i++)
+    res[i] = graphene_line_segment_get_distance_to_point (s, &points[i]);
+}
@@ -0,0 +1,99 @@
+/* graphene-line-segment.h: Segments
+ *
+ * Copyright © 2014  Emmanuele Bassi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_LINE_SEGMENT_H__
+#define __GRAPHENE_LINE_SEGMENT_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-point.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_line_segment_t:
+ *
+ * A line segment between two points.
+ *
+ * The contents of a #graphene_line_segment_t are private and should
+ * never be accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_line_segment_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_point_t, start);
+  GRAPHENE_PRIVATE_FIELD (graphene_point_t, end);
+};
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_line_segment_t *       graphene_line_segment_alloc                     (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_line_segment_free                      (graphene_line_segment_t       *s);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_line_segment_t *       graphene_line_segment_init                      (graphene_line_segment_t       *s,
+                                                                                 const graphene_point_t        *start,
+                                                                                 const graphene_point_t        *end);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_line_segment_get_start                 (const graphene_line_segment_t *s,
+                                                                                 graphene_point_t              *start);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_line_segment_get_end                   (const graphene_line_segment_t *s,
+                                                                                 graphene_point_t              *end);
+
+GRAPHENE_AVAILABLE_IN_1_4
+bool                            graphene_line_segment_points_on_same_side       (const graphene_line_segment_t *s,
+                                                                                 const graphene_point_t        *a,
+                                                                                 const graphene_point_t        *b);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                            graphene_line_segment_intersection              (const graphene_line_segment_t *a,
+                                                                                 const graphene_line_segment_t *b,
+                                                                                 graphene_point_t              *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_line_segment_get_closest_point         (const graphene_line_segment_t *s,
+                                                                                 const graphene_point_t        *p,
+                                                                                 graphene_point_t              *res);
+GRAPHENE_AVAILABLE_IN_1_4
+float                           graphene_line_segment_get_distance_to_point     (const graphene_line_segment_t *s,
+                                                                                 const graphene_point_t        *p);
+
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int                    graphene_line_segment_intersect_segments        (const graphene_line_segment_t *s,
+                                                                                 unsigned int                   n_segments,
+                                                                                 const graphene_line_segment_t  segments[],
+                                                                                 bool                           res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_line_segment_get_distances_to_points   (const graphene_line_segment_t *s,
+                                                                                 unsigned int                   n_points,
+                                                                                 const graphene_point_t         points[],
+                                                                                 float                          res[]);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_LINE_SEGMENT_H__ */
@@ -0,0 +1,235 @@
+/* graphene-matrix-private.h: In-place matrix transformations
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_MATRIX_PRIVATE_H__
+#define __GRAPHENE_MATRIX_PRIVATE_H__
+
+#include "graphene-private.h"
+
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+/* these kernels pre-multiply a matrix by a translation, scale, or
+ * rotation, like graphene_matrix_translate() and friends, without
+ * building the transformation matrix and without a full 4x4 multiply:
+ * each transformation only affects a subset of the rows
+ */
+
+/* the translation only changes the w row, which becomes
+ * t.x * m.x + t.y * m.y + t.z * m.z + m.w
+ */
+static inline void
+graphene_matrix_translate_internal (graphene_simd4x4f_t     *m,
+                                    const graphene_simd4f_t  t)
+{
+  m->w = graphene_simd4f_madd (graphene_simd4f_splat_x (t), m->x,
+                               graphene_simd4f_madd (graphene_simd4f_splat_y (t), m->y,
+                                                     graphene_simd4f_madd (graphene_simd4f_splat_z (t), m->z,
+                                                                           m->w)));
+}
+
+/* the scale multiplies each of the first three rows by a factor */
+static inline void
+graphene_matrix_scale_internal (graphene_simd4x4f_t *m,
+                                float                factor_x,
+                                float                factor_y,
+                                float                factor_z)
+{
+  m->x = graphene_simd4f_mul (m->x, graphene_simd4f_splat (factor_x));
+  m->y = graphene_simd4f_mul (m->y, graphene_simd4f_splat (factor_y));
+  m->z = graphene_simd4f_mul (m->z, graphene_simd4f_splat (factor_z));
+}
+
+/* a rotation around one of the axes mixes the other two rows */
+static inline void
+graphene_matrix_rotate_rows_internal (graphene_simd4f_t *a,
+                                      graphene_simd4f_t *b,
+                                      float              rad)
+{
+  graphene_simd4f_t s, c, row_a, row_b;
+  float sin_a, cos_a;
+
+  graphene_sincos (rad, &sin_a, &cos_a);
+
+  s = graphene_simd4f_splat (sin_a);
+  c = graphene_simd4f_splat (cos_a);
+  row_a = *a;
+  row_b = *b;
+
+  *a = graphene_simd4f_madd (c, row_a, graphene_simd4f_mul (s, row_b));
+  *b = graphene_simd4f_sub (graphene_simd4f_mul (c, row_b), graphene_simd4f_mul (s, row_a));
+}
+
+static inline void
+graphene_matrix_rotate_x_internal (graphene_simd4x4f_t *m,
+                                   float                rad)
+{
+  graphene_matrix_rotate_rows_internal (&m->y, &m->z, rad);
+}
+
+static inline void
+graphene_matrix_rotate_y_internal (graphene_simd4x4f_t *m,
+                                   float                rad)
+{
+  graphene_matrix_rotate_rows_internal (&m->z, &m->x, rad);
+}
+
+static inline void
+graphene_matrix_rotate_z_internal (graphene_simd4x4f_t *m,
+                                   float                rad)
+{
+  graphene_matrix_rotate_rows_internal (&m->x, &m->y, rad);
+}
+
+/* a rotation around an arbitrary axis replaces the first three rows
+ * with their combinations, using the rows of the 3x3 rotation matrix
+ */
+static inline void
+graphene_matrix_rotate_internal (graphene_simd4x4f_t     *m,
+                                 float                    rad,
+                                 const graphene_simd4f_t  axis)
+{
+  graphene_simd4x4f_t rot_m;
+  graphene_simd4f_t row_x, row_y, row_z;
+
+  graphene_simd4x4f_rotation (&rot_m, rad, axis);
+
+  row_x = m->x;
+  row_y = m->y;
+  row_z = m->z;
+
+  m->x = graphene_simd4f_madd (graphene_simd4f_splat_x (rot_m.x), row_x,
+                               graphene_simd4f_madd (graphene_simd4f_splat_y (rot_m.x), row_y,
+                                                     graphene_simd4f_mul (graphene_simd4f_splat_z (rot_m.x), row_z)));
+  m->y = graphene_simd4f_madd (graphene_simd4f_splat_x (rot_m.y), row_x,
+                               graphene_simd4f_madd (graphene_simd4f_splat_y (rot_m.y), row_y,
+                                                     graphene_simd4f_mul (graphene_simd4f_splat_z (rot_m.y), row_z)));
+  m->z = graphene_simd4f_madd (graphene_simd4f_splat_x (rot_m.z), row_x,
+                               graphene_simd4f_madd (graphene_simd4f_splat_y (rot_m.z), row_y,
+                                                     graphene_simd4f_mul (graphene_simd4f_splat_z (rot_m.z), row_z)));
+}
+
+/* the tolerance of the checks on the rows of a rotation matrix; the
+ * composition of a few rotations drifts by a handful of ULPs from an
+ * orthonormal basis, which the transposition can still invert
+ */
+#define GRAPHENE_MATRIX_ORTHONORMAL_EPSILON (16.f * FLT_EPSILON)
+
+/*< private >
+ * graphene_matrix_is_affine_internal:
+ * @m: a #graphene_simd4x4f_t
+ *
+ * Checks whether the last column of @m is exactly (0, 0, 0, 1), that
+ * is whether @m has no perspective component.
+ *
+ * The comparison is exact, like graphene_simd4x4f_is_2d(): the effect
+ * of a perspective term is scaled by the coordinates it multiplies, so
+ * no absolute tolerance can tell whether it is negligible. Affine
+ * matrices built by the library have exact zeros in the last column,
+ * which are preserved by their products.
+ */
+static inline bool
+graphene_matrix_is_affine_internal (const graphene_simd4x4f_t *m)
+{
+  return graphene_simd4f_get_w (m->x) == 0.f &&
+         graphene_simd4f_get_w (m->y) == 0.f &&
+         graphene_simd4f_get_w (m->z) == 0.f &&
+         graphene_simd4f_get_w (m->w) == 1.f;
+}
+
+/*< private >
+ * graphene_matrix_is_rigid_internal:
+ * @m: an affine #graphene_simd4x4f_t
+ *
+ * Checks whether the upper 3x3 component of @m is a rotation, that is
+ * whether its rows are orthonormal.
+ */
+static inline bool
+graphene_matrix_is_rigid_internal (const graphene_simd4x4f_t *m)
+{
+  return fabsf (graphene_simd4f_dot3_scalar (m->x, m->x) - 1.f) < GRAPHENE_MATRIX_ORTHONORMAL_EPSILON &&
+         fabsf (graphene_simd4f_dot3_scalar (m->y, m->y) - 1.f) < GRAPHENE_MATRIX_ORTHONORMAL_EPSILON &&
+         fabsf (graphene_simd4f_dot3_scalar (m->z, m->z) - 1.f) < GRAPHENE_MATRIX_ORTHONORMAL_EPSILON &&
+         fabsf (graphene_simd4f_dot3_scalar (m->x, m->y)) < GRAPHENE_MATRIX_ORTHONORMAL_EPSILON &&
+         fabsf (graphene_simd4f_dot3_scalar (m->x, m->z)) < GRAPHENE_MATRIX_ORTHONORMAL_EPSILON &&
+         fabsf (graphene_simd4f_dot3_scalar (m->y, m->z)) < GRAPHENE_MATRIX_ORTHONORMAL_EPSILON;
+}
+
+/*< private >
+ * graphene_matrix_is_scale_translate_internal:
+ * @m: an affine #graphene_simd4x4f_t
+ *
+ * Checks whether the upper 3x3 component of @m is diagonal; like in
+ * graphene_matrix_preserves_axis_alignment(), the cross terms are
+ * compared relative to the axis terms.
+ */
+static inline bool
+graphene_matrix_is_scale_translate_internal (const graphene_simd4x4f_t *m)
+{
+  float r_x[4], r_y[4], r_z[4];
+
+  graphene_simd4f_dup_4f (m->x, r_x);
+  graphene_simd4f_dup_4f (m->y, r_y);
+  graphene_simd4f_dup_4f (m->z, r_z);
+
+  return fabsf (r_x[1]) <= fabsf (r_x[0]) * FLT_EPSILON &&
+         fabsf (r_x[2]) <= fabsf (r_x[0]) * FLT_EPSILON &&
+         fabsf (r_y[0]) <= fabsf (r_y[1]) * FLT_EPSILON &&
+         fabsf (r_y[2]) <= fabsf (r_y[1]) * FLT_EPSILON &&
+         fabsf (r_z[0]) <= fabsf (r_z[2]) * FLT_EPSILON &&
+         fabsf (r_z[1]) <= fabsf (r_z[2]) * FLT_EPSILON;
+}
+
+/*< private >
+ * graphene_matrix3x4_transform_internal:
+ * @x: the first row of a #graphene_matrix3x4_t
+ * @y: the second row of a #graphene_matrix3x4_t
+ * @z: the third row of a #graphene_matrix3x4_t
+ * @v: the vector to transform; the w component is 1 for a point,
+ *   and 0 for a direction
+ *
+ * Transforms @v with the affine matrix stored in @x, @y, and @z; each
+ * component of the result is the dot product of @v with one row, so
+ * the products are transposed and summed at the same time.
+ *
+ * Returns: the transformed vector, with the w component set to 0
+ */
+static inline graphene_simd4f_t
+graphene_matrix3x4_transform_internal (const graphene_simd4f_t x,
+                                       const graphene_simd4f_t y,
+                                       const graphene_simd4f_t z,
+                                       const graphene_simd4f_t v)
+{
+  graphene_simd4x4f_t t;
+
+  t = graphene_simd4x4f_init (graphene_simd4f_mul (x, v),
+                              graphene_simd4f_mul (y, v),
+                              graphene_simd4f_mul (z, v),
+                              graphene_simd4f_init_zero ());
+  graphene_simd4x4f_transpose_in_place (&t);
+
+  return graphene_simd4f_add (graphene_simd4f_add (t.x, t.y),
+                              graphene_simd4f_add (t.z, t.w));
+}
+
+#endif /* __GRAPHENE_MATRIX_PRIVATE_H__ */
@@ -0,0 +1,440 @@
+/* graphene-matrix-stack.c: Stack of transformations
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-matrix-stack
+ * @Title: Matrix stack
+ * @Short_Description: Stack of cumulative transformations
+ *
+ * #graphene_matrix_stack_t keeps the cumulative transformations of a
+ * tree of nested coordinate spaces, like the scene graph of a renderer:
+ * each push composes a transformation with the current one, and each pop
+ * restores the previous one.
+ *
+ * Each entry of the stack caches the kind of transformation it describes,
+ * and its inverse once it has been requested with
+ * graphene_matrix_stack_get_inverse(). Translations are accumulated
+ * without any matrix multiplication, and their inverse is updated from
+ * the inverse of the previous entry, if available, instead of inverting
+ * the whole transformation.
+ *
+ * The entries are stored in a single buffer, which is retained when
+ * popping entries and when re-initializing the stack, so that walking
+ * a tree does not require allocations.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-matrix-stack.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-matrix-private.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum {
+  MATRIX_STACK_INVERSE_UNKNOWN,
+  MATRIX_STACK_INVERSE_VALID,
+  MATRIX_STACK_INVERSE_SINGULAR
+} matrix_stack_inverse_t;
+
+typedef struct {
+  graphene_matrix_t transform;
+  graphene_matrix_t inverse;
+
+  graphene_transform_type_t type;
+  matrix_stack_inverse_t inverse_state;
+} matrix_stack_entry_t;
+
+/**
+ * graphene_matrix_stack_t:
+ *
+ * An opaque structure holding a stack of cumulative transformations.
+ *
+ * Since: 1.4
+ */
+struct _graphene_matrix_stack_t
+{
+  /* the first entry is always the identity */
+  matrix_stack_entry_t *entries;
+  unsigned int n_entries;
+  unsigned int entries_size;
+};
+
+/**
+ * graphene_matrix_stack_alloc: (constructor)
+ *
+ * Allocates a new #graphene_matrix_stack_t.
+ *
+ * The contents of the returned structure are undefined until
+ * graphene_matrix_stack_init() is called.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_matrix_stack_t.
+ *   Use graphene_matrix_stack_free() to free the resources allocated
+ *   by this function
+ *
+ * Since: 1.4
+ */
+graphene_matrix_stack_t *
+graphene_matrix_stack_alloc (void)
+{
+  return calloc (1, sizeof (graphene_matrix_stack_t));
+}
+
+/**
+ * graphene_matrix_stack_free:
+ * @s: a #graphene_matrix_stack_t
+ *
+ * Frees the resources allocated by graphene_matrix_stack_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_stack_free (graphene_matrix_stack_t *s)
+{
+  if (s == NULL)
+    return;
+
+  graphene_aligned_free (s->entries);
+  free (s);
+}
+
+/*< private >
+ * matrix_stack_push_entry:
+ * @s: a #graphene_matrix_stack_t
+ *
+ * Appends a new entry, growing the storage if needed.
+ *
+ * Returns: the new entry; the previous entry immediately precedes it
+ */
+static matrix_stack_entry_t *
+matrix_stack_push_entry (graphene_matrix_stack_t *s)
+{
+  if (s->n_entries == s->entries_size)
+    {
+      unsigned int size = s->entries_size > 0 ? s->entries_size * 2 : 16;
+      matrix_stack_entry_t *entries;
+
+      entries = graphene_aligned_alloc (sizeof (matrix_stack_entry_t), size, 16);
+      if (s->n_entries > 0)
+        memcpy (entries, s->entries, s->n_entries * sizeof (matrix_stack_entry_t));
+
+      graphene_aligned_free (s->entries);
+      s->entries = entries;
+      s->entries_size = size;
+    }
+
+  return &s->entries[s->n_entries++];
+}
+
+/**
+ * graphene_matrix_stack_init:
+ * @s: the #graphene_matrix_stack_t to initialize
+ *
+ * Initializes a #graphene_matrix_stack_t, and removes all the entries
+ * previously pushed; the current transformation is the identity.
+ *
+ * Returns: (transfer none): the initialized #graphene_matrix_stack_t
+ *
+ * Since: 1.4
+ */
+graphene_matrix_stack_t *
+graphene_matrix_stack_init (graphene_matrix_stack_t *s)
+{
+  matrix_stack_entry_t *entry;
+
+  s->n_entries = 0;
+
+  entry = matrix_stack_push_entry (s);
+  graphene_simd4x4f_init_identity (&entry->transform.value);
+  graphene_simd4x4f_init_identity (&entry->inverse.value);
+  entry->type = GRAPHENE_TRANSFORM_IDENTITY;
+  entry->inverse_state = MATRIX_STACK_INVERSE_VALID;
+
+  return s;
+}
+
+/*< private >
+ * matrix_get_transform_type:
+ * @m: a #graphene_simd4x4f_t
+ *
+ * Classifies the transformation described by @m; only matrices whose
+ * upper 3x3 component is exactly the identity are translations.
+ */
+static inline graphene_transform_type_t
+matrix_get_transform_type (const graphene_simd4x4f_t *m)
+{
+  if (!graphene_matrix_is_affine_internal (m))
+    return GRAPHENE_TRANSFORM_PROJECTIVE;
+
+  if (!(graphene_simd4f_cmp_eq (m->x, graphene_simd4f_init (1.f, 0.f, 0.f, 0.f)) &&
+        graphene_simd4f_cmp_eq (m->y, graphene_simd4f_init (0.f, 1.f, 0.f, 0.f)) &&
+        graphene_simd4f_cmp_eq (m->z, graphene_simd4f_init (0.f, 0.f, 1.f, 0.f))))
+    return GRAPHENE_TRANSFORM_AFFINE;
+
+  if (graphene_simd4f_cmp_eq (m->w, graphene_simd4f_init (0.f, 0.f, 0.f, 1.f)))
+    return GRAPHENE_TRANSFORM_IDENTITY;
+
+  return GRAPHENE_TRANSFORM_TRANSLATE;
+}
+
+/*< private >
+ * matrix_stack_push_translation:
+ * @s: a #graphene_matrix_stack_t
+ * @t: the translation, with the w component set to 0
+ *
+ * Pushes the translation by @t; the transformation of a translation
+ * only requires a change of its last row, and the inverse, if known,
+ * is updated by translating its rows by the opposite of @t.
+ */
+static void
+matrix_stack_push_translation (graphene_matrix_stack_t *s,
+                               graphene_simd4f_t        t)
+{
+  matrix_stack_entry_t *entry = matrix_stack_push_entry (s);
+  const matrix_stack_entry_t *parent = entry - 1;
+
+  entry->transform = parent->transform;
+
+  if (parent->type <= GRAPHENE_TRANSFORM_TRANSLATE)
+    {
+      entry->transform.value.w = graphene_simd4f_add (parent->transform.value.w, t);
+      entry->type = GRAPHENE_TRANSFORM_TRANSLATE;
+    }
+  else
+    {
+      graphene_matrix_translate_internal (&entry->transform.value, t);
+      entry->type = parent->type;
+    }
+
+  entry->inverse_state = parent->inverse_state;
+
+  if (parent->inverse_state == MATRIX_STACK_INVERSE_VALID)
+    {
+      const graphene_simd4x4f_t *inv = &parent->inverse.value;
+
+      entry->inverse.value.x = graphene_simd4f_sub (inv->x, graphene_simd4f_mul (graphene_simd4f_splat_w (inv->x), t));
+      entry->inverse.value.y = graphene_simd4f_sub (inv->y, graphene_simd4f_mul (graphene_simd4f_splat_w (inv->y), t));
+      entry->inverse.value.z = graphene_simd4f_sub (inv->z, graphene_simd4f_mul (graphene_simd4f_splat_w (inv->z), t));
+      entry->inverse.value.w = graphene_simd4f_sub (inv->w, graphene_simd4f_mul (graphene_simd4f_splat_w (inv->w), t));
+    }
+}
+
+/**
+ * graphene_matrix_stack_push_multiply:
+ * @s: a #graphene_matrix_stack_t
+ * @m: a #graphene_matrix_t
+ *
+ * Pushes a new entry on the stack, transforming the coordinate space
+ * of the current entry by @m; that is, the new transformation is the
+ * result of graphene_matrix_multiply() between @m and the current
+ * transformation.
+ *
+ * Identity matrices and translations do not require any matrix
+ * multiplication.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_stack_push_multiply (graphene_matrix_stack_t *s,
+                                     const graphene_matrix_t *m)
+{
+  graphene_transform_type_t m_type = matrix_get_transform_type (&m->value);
+  matrix_stack_entry_t *entry;
+  const matrix_stack_entry_t *parent;
+
+  if (m_type == GRAPHENE_TRANSFORM_TRANSLATE)
+    {
+      matrix_stack_push_translation (s, graphene_simd4f_zero_w (m->value.w));
+      return;
+    }
+
+  entry = matrix_stack_push_entry (s);
+  parent = entry - 1;
+
+  if (m_type == GRAPHENE_TRANSFORM_IDENTITY)
+    {
+      *entry = *parent;
+      return;
+    }
+
+  if (parent->type == GRAPHENE_TRANSFORM_IDENTITY)
+    entry->transform = *m;
+  else
+    graphene_simd4x4f_matrix_mul (&m->value, &parent->transform.value, &entry->transform.value);
+
+  /* the product of affine transformations is affine; a projective
+   * transformation is not reclassified, even if the product is affine
+   */
+  entry->type = MAX (m_type, parent->type);
+  entry->inverse_state = MATRIX_STACK_INVERSE_UNKNOWN;
+}
+
+/**
+ * graphene_matrix_stack_push_translate:
+ * @s: a #graphene_matrix_stack_t
+ * @pos: a #graphene_point3d_t
+ *
+ * Pushes a new entry on the stack, translating the coordinate space
+ * of the current entry by @pos; this is equivalent to, but faster than,
+ * graphene_matrix_stack_push_multiply() with a translation matrix.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_stack_push_translate (graphene_matrix_stack_t  *s,
+                                      const graphene_point3d_t *pos)
+{
+  matrix_stack_push_translation (s, graphene_simd4f_init (pos->x, pos->y, pos->z, 0.f));
+}
+
+/**
+ * graphene_matrix_stack_pop:
+ * @s: a #graphene_matrix_stack_t
+ *
+ * Removes the current entry from the stack, and restores the previous
+ * transformation.
+ *
+ * Returns: `true` if an entry was removed, and `false` if the stack
+ *   had no entries pushed
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_stack_pop (graphene_matrix_stack_t *s)
+{
+  if (s->n_entries <= 1)
+    return false;
+
+  s->n_entries -= 1;
+
+  return true;
+}
+
+/**
+ * graphene_matrix_stack_get_depth:
+ * @s: a #graphene_matrix_stack_t
+ *
+ * Retrieves the number of entries pushed on the stack since it was
+ * initialized.
+ *
+ * Returns: the number of entries
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_matrix_stack_get_depth (const graphene_matrix_stack_t *s)
+{
+  return s->n_entries - 1;
+}
+
+/**
+ * graphene_matrix_stack_get_transform:
+ * @s: a #graphene_matrix_stack_t
+ * @res: (out caller-allocates): return location for the transformation
+ *
+ * Retrieves the cumulative transformation of the current entry.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_stack_get_transform (const graphene_matrix_stack_t *s,
+                                     graphene_matrix_t             *res)
+{
+  *res = s->entries[s->n_entries - 1].transform;
+}
+
+/**
+ * graphene_matrix_stack_get_inverse:
+ * @s: a #graphene_matrix_stack_t
+ * @res: (out caller-allocates): return location for the inverse
+ *   transformation
+ *
+ * Retrieves the inverse of the cumulative transformation of the current
+ * entry.
+ *
+ * The inverse is computed the first time it is requested, using the
+ * cheapest method for the kind of transformation, and then cached until
+ * the entry is popped; the inverse of a translation is computed without
+ * any division.
+ *
+ * If the transformation cannot be inverted, @res is set to the identity.
+ *
+ * Returns: `true` if the transformation is invertible
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_stack_get_inverse (graphene_matrix_stack_t *s,
+                                   graphene_matrix_t       *res)
+{
+  matrix_stack_entry_t *entry = &s->entries[s->n_entries - 1];
+
+  if (entry->inverse_state == MATRIX_STACK_INVERSE_UNKNOWN)
+    {
+      if (entry->type <= GRAPHENE_TRANSFORM_TRANSLATE)
+        {
+          graphene_simd4x4f_init_identity (&entry->inverse.value);
+          entry->inverse.value.w = graphene_simd4f_merge_w (graphene_simd4f_neg (entry->transform.value.w), 1.f);
+          entry->inverse_state = MATRIX_STACK_INVERSE_VALID;
+        }
+      else if (graphene_matrix_inverse (&entry->transform, &entry->inverse))
+        {
+          entry->inverse_state = MATRIX_STACK_INVERSE_VALID;
+        }
+      else
+        {
+          graphene_simd4x4f_init_identity (&entry->inverse.value);
+          entry->inverse_state = MATRIX_STACK_INVERSE_SINGULAR;
+        }
+    }
+
+  *res = entry->inverse;
+
+  return entry->inverse_state == MATRIX_STACK_INVERSE_VALID;
+}
+
+/**
+ * graphene_matrix_stack_get_transform_type:
+ * @s: a #graphene_matrix_stack_t
+ *
+ * Retrieves the kind of the cumulative transformation of the current
+ * entry.
+ *
+ * The type is propagated when pushing entries, without inspecting the
+ * resulting matrix, so it may describe a larger set of transformations
+ * than needed; for instance, a translation followed by its opposite is
+ * still classified as a translation.
+ *
+ * Returns: the type of the transformation
+ *
+ * Since: 1.4
+ */
+graphene_transform_type_t
+graphene_matrix_stack_get_transform_type (const graphene_matrix_stack_t *s)
+{
+  return s->entries[s->n_entries - 1].type;
+}
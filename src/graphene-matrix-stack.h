@@ -0,0 +1,88 @@
+/* graphene-matrix-stack.h: Stack of transformations
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_MATRIX_STACK_H__
+#define __GRAPHENE_MATRIX_STACK_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-matrix.h"
+#include "graphene-point3d.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_transform_type_t:
+ * @GRAPHENE_TRANSFORM_IDENTITY: The identity transformation
+ * @GRAPHENE_TRANSFORM_TRANSLATE: A translation
+ * @GRAPHENE_TRANSFORM_AFFINE: A transformation without a perspective
+ *   component
+ * @GRAPHENE_TRANSFORM_PROJECTIVE: A generic transformation, with
+ *   a perspective component
+ *
+ * The kind of transformation described by the current entry of a
+ * #graphene_matrix_stack_t; each kind is a subset of the following ones.
+ *
+ * Since: 1.4
+ */
+typedef enum {
+  GRAPHENE_TRANSFORM_IDENTITY,
+  GRAPHENE_TRANSFORM_TRANSLATE,
+  GRAPHENE_TRANSFORM_AFFINE,
+  GRAPHENE_TRANSFORM_PROJECTIVE
+} graphene_transform_type_t;
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix_stack_t *       graphene_matrix_stack_alloc             (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_matrix_stack_free              (graphene_matrix_stack_t  *s);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix_stack_t *       graphene_matrix_stack_init              (graphene_matrix_stack_t  *s);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_matrix_stack_push_multiply     (graphene_matrix_stack_t  *s,
+                                                                         const graphene_matrix_t  *m);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_matrix_stack_push_translate    (graphene_matrix_stack_t  *s,
+                                                                         const graphene_point3d_t *pos);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                            graphene_matrix_stack_pop               (graphene_matrix_stack_t  *s);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int                    graphene_matrix_stack_get_depth         (const graphene_matrix_stack_t *s);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_matrix_stack_get_transform     (const graphene_matrix_stack_t *s,
+                                                                         graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                            graphene_matrix_stack_get_inverse       (graphene_matrix_stack_t  *s,
+                                                                         graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_transform_type_t       graphene_matrix_stack_get_transform_type (const graphene_matrix_stack_t *s);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_MATRIX_STACK_H__ */
@@ -58,6 +58,8 @@
 #include "graphene-point3d.h"
 #include "graphene-quad.h"
 #include "graphene-quaternion.h"
+#include "graphene-matrix-private.h"
+#include "graphene-quaternion-private.h"
 #include "graphene-ray.h"
 #include "graphene-rect.h"
 #include "graphene-simd4x4f.h"
@@ -495,6 +497,51 @@ graphene_matrix_is_2d (const graphene_matrix_t *m)
 #endif
 }
 
+/**
+ * graphene_matrix_preserves_axis_alignment:
+ * @m: a #graphene_matrix_t
+ *
+ * Checks whether the given #graphene_matrix_t maps axis-aligned
+ * rectangles on the XY plane to axis-aligned rectangles, that is
+ * whether the 2D part of the transformation is a combination of
+ * translations, scales, and rotations by multiples of 90 degrees.
+ *
+ * Matrices that preserve the axis alignment can be applied to a
+ * #graphene_rect_t without having to fall back to a #graphene_quad_t.
+ *
+ * Returns: `true` if the matrix preserves the axis alignment
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_preserves_axis_alignment (const graphene_matrix_t *m)
+{
+  float r_x[4], r_y[4];
+
+  graphene_simd4f_dup_4f (m->value.x, r_x);
+  graphene_simd4f_dup_4f (m->value.y, r_y);
+
+  /* no perspective on the XY plane */
+  if (!(fabsf (r_x[3]) < FLT_EPSILON &&
+        fabsf (r_y[3]) < FLT_EPSILON &&
+        fabsf (1.f - graphene_simd4f_get_w (m->value.w)) < FLT_EPSILON))
+    return false;
+
+  /* the cross terms are compared relative to the axis terms, so that
+   * scaled quarter turns, whose cosine is never exactly zero, still
+   * count as rectilinear
+   */
+  if (fabsf (r_x[1]) <= fabsf (r_x[0]) * FLT_EPSILON &&
+      fabsf (r_y[0]) <= fabsf (r_y[1]) * FLT_EPSILON)
+    return true;
+
+  if (fabsf (r_x[0]) <= fabsf (r_x[1]) * FLT_EPSILON &&
+      fabsf (r_y[1]) <= fabsf (r_y[0]) * FLT_EPSILON)
+    return true;
+
+  return false;
+}
+
 /**
  * graphene_matrix_is_backface_visible:
  * @m: a #graphene_matrix_t
@@ -537,6 +584,110 @@ graphene_matrix_is_singular (const graphene_matrix_t *m)
   return fabsf (graphene_simd4f_get_x (det)) <= GRAPHENE_FLOAT_EPSILON;
 }
 
+/**
+ * graphene_matrix_exact_equal:
+ * @a: a #graphene_matrix_t
+ * @b: a #graphene_matrix_t
+ *
+ * Checks whether the two given #graphene_matrix_t matrices are
+ * exactly equal, component by component; -0 and +0 are equal.
+ *
+ * This function does not account for floating point fluctuations, so
+ * that two equal matrices always have the same graphene_matrix_hash();
+ * if you want to control the fuzziness of the match, you can use
+ * graphene_matrix_near() instead.
+ *
+ * Returns: `true` if the two matrices are exactly equal
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_exact_equal (const graphene_matrix_t *a,
+                             const graphene_matrix_t *b)
+{
+  if (a == b)
+    return true;
+
+  if (a == NULL || b == NULL)
+    return false;
+
+  return graphene_simd4f_cmp_eq (a->value.x, b->value.x) &&
+         graphene_simd4f_cmp_eq (a->value.y, b->value.y) &&
+         graphene_simd4f_cmp_eq (a->value.z, b->value.z) &&
+         graphene_simd4f_cmp_eq (a->value.w, b->value.w);
+}
+
+static inline bool
+matrix_row_near (const graphene_simd4f_t a,
+                 const graphene_simd4f_t b,
+                 const graphene_simd4f_t epsilon)
+{
+  graphene_simd4f_t d = graphene_simd4f_sub (a, b);
+
+  d = graphene_simd4f_max (d, graphene_simd4f_neg (d));
+
+  return graphene_simd4f_cmp_le (d, epsilon);
+}
+
+/**
+ * graphene_matrix_near:
+ * @a: a #graphene_matrix_t
+ * @b: a #graphene_matrix_t
+ * @epsilon: the threshold between the two matrices
+ *
+ * Checks whether all the components of the two given #graphene_matrix_t
+ * matrices are within @epsilon of each other.
+ *
+ * Returns: `true` if the two matrices are near each other
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_near (const graphene_matrix_t *a,
+                      const graphene_matrix_t *b,
+                      float                    epsilon)
+{
+  graphene_simd4f_t e;
+
+  if (a == b)
+    return true;
+
+  if (a == NULL || b == NULL)
+    return false;
+
+  e = graphene_simd4f_splat (epsilon);
+
+  return matrix_row_near (a->value.x, b->value.x, e) &&
+         matrix_row_near (a->value.y, b->value.y, e) &&
+         matrix_row_near (a->value.z, b->value.z, e) &&
+         matrix_row_near (a->value.w, b->value.w, e);
+}
+
+/**
+ * graphene_matrix_hash:
+ * @m: a #graphene_matrix_t
+ *
+ * Computes a hash value for the given #graphene_matrix_t, suitable
+ * for using matrices as keys in a hash table, together with
+ * graphene_matrix_exact_equal().
+ *
+ * The hash value is computed on the components of the matrix, and
+ * it is stable across platforms; -0 and +0 have the same hash.
+ *
+ * Returns: the hash value of the matrix
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_matrix_hash (const graphene_matrix_t *m)
+{
+  float v[16];
+
+  graphene_simd4x4f_to_float (&m->value, v);
+
+  return graphene_hash_floats (v, 16);
+}
+
 /**
  * graphene_matrix_init_from_2d:
  * @m: a #graphene_matrix_t
@@ -911,6 +1062,103 @@ graphene_matrix_transform_rect (const graphene_matrix_t *m,
   graphene_quad_init (res, &ret[0], &ret[1], &ret[2], &ret[3]);
 }
 
+/*< private >
+ * matrix_rect_corners:
+ * @r: a #graphene_rect_t
+ * @xs: (out): return location for the x coordinates of the corners
+ * @ys: (out): return location for the y coordinates of the corners
+ *
+ * Loads the four corners of @r, with each coordinate in its own vector.
+ *
+ * The order of the corners does not depend on the sign of the size
+ * of @r, but the bounds of the corners do not depend on their order.
+ */
+static inline void
+matrix_rect_corners (const graphene_rect_t *r,
+                     graphene_simd4f_t     *xs,
+                     graphene_simd4f_t     *ys)
+{
+  float x_0 = r->origin.x, x_1 = r->origin.x + r->size.width;
+  float y_0 = r->origin.y, y_1 = r->origin.y + r->size.height;
+
+  *xs = graphene_simd4f_init (x_0, x_1, x_1, x_0);
+  *ys = graphene_simd4f_init (y_0, y_0, y_1, y_1);
+}
+
+static inline void
+matrix_rect_bounds (const graphene_simd4f_t  xs,
+                    const graphene_simd4f_t  ys,
+                    graphene_rect_t         *res)
+{
+  float min_x = graphene_simd4f_get_x (graphene_simd4f_min_val (xs));
+  float min_y = graphene_simd4f_get_x (graphene_simd4f_min_val (ys));
+  float max_x = graphene_simd4f_get_x (graphene_simd4f_max_val (xs));
+  float max_y = graphene_simd4f_get_x (graphene_simd4f_max_val (ys));
+
+  graphene_rect_init (res, min_x, min_y, max_x - min_x, max_y - min_y);
+}
+
+/*< private >
+ * matrix_transform_bounds_scale:
+ * @m: a #graphene_simd4x4f_t with a diagonal upper 3x3 component
+ * @r: a #graphene_rect_t
+ * @res: (out caller-allocates): return location for the bounds
+ *
+ * Transforms @r with a scale matrix; the transformed rectangle is
+ * still aligned to the axes, so its bounds are given by two corners.
+ */
+static inline void
+matrix_transform_bounds_scale (const graphene_simd4x4f_t *m,
+                               const graphene_rect_t     *r,
+                               graphene_rect_t           *res)
+{
+  graphene_simd4f_t p_0, p_1, min_v, max_v;
+
+  p_0 = graphene_simd4f_init (r->origin.x, r->origin.y, 0.f, 0.f);
+  p_1 = graphene_simd4f_init (r->origin.x + r->size.width,
+                              r->origin.y + r->size.height,
+                              0.f, 0.f);
+
+  graphene_simd4x4f_vec3_mul (m, &p_0, &p_0);
+  graphene_simd4x4f_vec3_mul (m, &p_1, &p_1);
+
+  min_v = graphene_simd4f_min (p_0, p_1);
+  max_v = graphene_simd4f_max (p_0, p_1);
+
+  graphene_rect_init (res,
+                      graphene_simd4f_get_x (min_v),
+                      graphene_simd4f_get_y (min_v),
+                      graphene_simd4f_get_x (max_v) - graphene_simd4f_get_x (min_v),
+                      graphene_simd4f_get_y (max_v) - graphene_simd4f_get_y (min_v));
+}
+
+/*< private >
+ * matrix_transform_bounds_corners:
+ * @m: a #graphene_simd4x4f_t
+ * @r: a #graphene_rect_t
+ * @res: (out caller-allocates): return location for the bounds
+ *
+ * Transforms the four corners of @r at the same time, and computes
+ * their bounds; since the corners lie on the z = 0 plane, only the
+ * upper 2x2 component of @m is needed.
+ */
+static inline void
+matrix_transform_bounds_corners (const graphene_simd4x4f_t *m,
+                                 const graphene_rect_t     *r,
+                                 graphene_rect_t           *res)
+{
+  graphene_simd4f_t xs, ys, res_x, res_y;
+
+  matrix_rect_corners (r, &xs, &ys);
+
+  res_x = graphene_simd4f_madd (xs, graphene_simd4f_splat_x (m->x),
+                                graphene_simd4f_mul (ys, graphene_simd4f_splat_x (m->y)));
+  res_y = graphene_simd4f_madd (xs, graphene_simd4f_splat_y (m->x),
+                                graphene_simd4f_mul (ys, graphene_simd4f_splat_y (m->y)));
+
+  matrix_rect_bounds (res_x, res_y, res);
+}
+
 /**
  * graphene_matrix_transform_bounds:
  * @m: a #graphene_matrix_t
@@ -928,56 +1176,45 @@ graphene_matrix_transform_bounds (const graphene_matrix_t *m,
                                   const graphene_rect_t   *r,
                                   graphene_rect_t         *res)
 {
-  graphene_point_t ret[4];
-  float min_x, min_y;
-  float max_x, max_y;
-
-#define TRANSFORM_POINT(matrix,rect,corner,out_p)   do { \
-  graphene_simd4f_t __s; \
-  graphene_point_t __p; \
-  graphene_rect_get_ ## corner (rect, &__p); \
-  __s = graphene_simd4f_init (__p.x, __p.y, 0.f, 0.f); \
-  graphene_simd4x4f_vec3_mul (&matrix->value, &__s, &__s); \
-  out_p.x = graphene_simd4f_get (__s, 0); \
-  out_p.y = graphene_simd4f_get (__s, 1);           } while (0)
-
-  TRANSFORM_POINT (m, r, top_left, ret[0]);
-  TRANSFORM_POINT (m, r, top_right, ret[1]);
-  TRANSFORM_POINT (m, r, bottom_right, ret[2]);
-  TRANSFORM_POINT (m, r, bottom_left, ret[3]);
-
-#undef TRANSFORM_POINT
-
-#if 0
-  {
-    int i;
-
-    min_x = max_x = ret[0].x;
-    min_y = max_y = ret[0].y;
-
-    for (i = 1; i < 4; i += 1)
-      {
-        min_x = MIN (ret[i].x, min_x);
-        min_y = MIN (ret[i].y, min_y);
-
-        max_x = MAX (ret[i].x, max_x);
-        max_y = MAX (ret[i].y, max_y);
-      }
-  }
-#else
-  {
-    const graphene_simd4f_t vx = graphene_simd4f_init (ret[0].x, ret[1].x, ret[2].x, ret[3].x);
-    const graphene_simd4f_t vy = graphene_simd4f_init (ret[0].y, ret[1].y, ret[2].y, ret[3].y);
-
-    min_x = graphene_simd4f_get_x (graphene_simd4f_min_val (vx));
-    min_y = graphene_simd4f_get_x (graphene_simd4f_min_val (vy));
+  if (graphene_matrix_is_scale_translate_internal (&m->value))
+    matrix_transform_bounds_scale (&m->value, r, res);
+  else
+    matrix_transform_bounds_corners (&m->value, r, res);
+}
 
-    max_x = graphene_simd4f_get_x (graphene_simd4f_max_val (vx));
-    max_y = graphene_simd4f_get_x (graphene_simd4f_max_val (vy));
-  }
-#endif
+/**
+ * graphene_matrix_transform_bounds_array:
+ * @m: a #graphene_matrix_t
+ * @n_rects: the number of rectangles to transform
+ * @rects: (array length=n_rects): the rectangles to transform
+ * @res: (out caller-allocates) (array length=n_rects): return location
+ *   for the bounds of the transformed rectangles
+ *
+ * Transforms an array of #graphene_rect_t using the given matrix @m,
+ * like graphene_matrix_transform_bounds().
+ *
+ * The @rects and @res arrays can be the same.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_transform_bounds_array (const graphene_matrix_t *m,
+                                        unsigned int             n_rects,
+                                        const graphene_rect_t    rects[],
+                                        graphene_rect_t          res[])
+{
+  unsigned int i;
 
-  graphene_rect_init (res, min_x, min_y, max_x - min_x, max_y - min_y);
+  if (graphene_matrix_is_scale_translate_internal (&m->value))
+    {
+      for (i = 0; i < n_rects; i++)
+        matrix_transform_bounds_scale (&m->value, &rects[i], &res[i]);
+    }
+  else
+    {
+      for (i = 0; i < n_rects; i++)
+        matrix_transform_bounds_corners (&m->value, &rects[i], &res[i]);
+    }
 }
 
 /**
@@ -1008,6 +1245,71 @@ graphene_matrix_transform_sphere (const graphene_matrix_t *m,
   res->radius = s->radius * sqrtf (max_scale);
 }
 
+/*< private >
+ * matrix_transform_box_affine:
+ * @m: an affine #graphene_simd4x4f_t
+ * @abs_m: the absolute values of the first three rows of @m
+ * @b: a #graphene_box_t
+ * @res: (out caller-allocates): return location for the bounds
+ *   of the transformed box
+ *
+ * Transforms @b using its center and half extents, as described by
+ * James Arvo in "Transforming Axis-Aligned Bounding Boxes": the
+ * center is transformed as a point, and the extents of the bounding
+ * box are the extents of @b multiplied by @abs_m.
+ */
+static inline void
+matrix_transform_box_affine (const graphene_simd4x4f_t *m,
+                             const graphene_simd4x4f_t *abs_m,
+                             const graphene_box_t      *b,
+                             graphene_box_t            *res)
+{
+  const graphene_simd4f_t half = graphene_simd4f_splat (0.5f);
+  graphene_simd4f_t center, extent;
+
+  /* an empty box remains empty */
+  if (!graphene_simd4f_cmp_le (b->min.value, b->max.value))
+    {
+      graphene_box_init_from_box (res, graphene_box_empty ());
+      return;
+    }
+
+  center = graphene_simd4f_mul (graphene_simd4f_add (b->min.value, b->max.value), half);
+  extent = graphene_simd4f_mul (graphene_simd4f_sub (b->max.value, b->min.value), half);
+
+  graphene_simd4x4f_point3_mul (m, &center, &center);
+  graphene_simd4x4f_vec3_mul (abs_m, &extent, &extent);
+
+  res->min.value = graphene_simd4f_zero_w (graphene_simd4f_sub (center, extent));
+  res->max.value = graphene_simd4f_zero_w (graphene_simd4f_add (center, extent));
+}
+
+static inline void
+matrix_abs (const graphene_simd4x4f_t *m,
+            graphene_simd4x4f_t       *res)
+{
+  res->x = graphene_simd4f_max (m->x, graphene_simd4f_neg (m->x));
+  res->y = graphene_simd4f_max (m->y, graphene_simd4f_neg (m->y));
+  res->z = graphene_simd4f_max (m->z, graphene_simd4f_neg (m->z));
+  res->w = m->w;
+}
+
+static inline void
+matrix_transform_box_vertices (const graphene_simd4x4f_t *m,
+                               const graphene_box_t      *b,
+                               graphene_box_t            *res)
+{
+  graphene_vec3_t points[8];
+  unsigned int i;
+
+  graphene_box_get_vertices (b, points);
+
+  for (i = 0; i < 8; i++)
+    graphene_simd4x4f_point3_mul (m, &(points[i].value), &(points[i].value));
+
+  graphene_box_init_from_vectors (res, 8, points);
+}
+
 /**
  * graphene_matrix_transform_box:
  * @m: a #graphene_matrix_t
@@ -1018,6 +1320,10 @@ graphene_matrix_transform_sphere (const graphene_matrix_t *m,
  * Transforms a #graphene_box_t using the given matrix @m. The
  * result is the bounding box containing the transformed box.
  *
+ * If @m is an affine transformation, the bounding box is computed
+ * from the center and the extents of @b, instead of transforming
+ * each one of its vertices.
+ *
  * Since: 1.2
  */
 void
@@ -1025,15 +1331,53 @@ graphene_matrix_transform_box (const graphene_matrix_t *m,
                                const graphene_box_t    *b,
                                graphene_box_t          *res)
 {
-  graphene_vec3_t points[8];
-  unsigned int i;
+  graphene_simd4x4f_t abs_m;
 
-  graphene_box_get_vertices (b, points);
+  if (graphene_matrix_is_affine_internal (&m->value))
+    {
+      matrix_abs (&m->value, &abs_m);
+      matrix_transform_box_affine (&m->value, &abs_m, b, res);
+    }
+  else
+    matrix_transform_box_vertices (&m->value, b, res);
+}
 
-  for (i = 0; i < 8; i++)
-    graphene_simd4x4f_point3_mul (&m->value, &(points[i].value), &(points[i].value));
+/**
+ * graphene_matrix_transform_boxes:
+ * @m: a #graphene_matrix_t
+ * @n_boxes: the number of boxes to transform
+ * @boxes: (array length=n_boxes): the boxes to transform
+ * @res: (out caller-allocates) (array length=n_boxes): return location
+ *   for the bounds of the transformed boxes
+ *
+ * Transforms an array of #graphene_box_t using the given matrix @m,
+ * like graphene_matrix_transform_box().
+ *
+ * The @boxes and @res arrays can be the same.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_transform_boxes (const graphene_matrix_t *m,
+                                 unsigned int             n_boxes,
+                                 const graphene_box_t     boxes[],
+                                 graphene_box_t           res[])
+{
+  graphene_simd4x4f_t abs_m;
+  unsigned int i;
 
-  graphene_box_init_from_vectors (res, 8, points);
+  if (graphene_matrix_is_affine_internal (&m->value))
+    {
+      matrix_abs (&m->value, &abs_m);
+
+      for (i = 0; i < n_boxes; i++)
+        matrix_transform_box_affine (&m->value, &abs_m, &boxes[i], &res[i]);
+    }
+  else
+    {
+      for (i = 0; i < n_boxes; i++)
+        matrix_transform_box_vertices (&m->value, &boxes[i], &res[i]);
+    }
 }
 
 /**
@@ -1098,6 +1442,41 @@ graphene_matrix_project_point (const graphene_matrix_t *m,
   graphene_point_init (res, a[0] + t * b[0], a[1] + t * b[1]);
 }
 
+/*< private >
+ * matrix_project_bounds_corners:
+ * @m: a #graphene_simd4x4f_t
+ * @r: a #graphene_rect_t
+ * @res: (out caller-allocates): return location for the bounds
+ *
+ * Projects the four corners of @r at the same time, like
+ * graphene_matrix_project_point(), and computes their bounds.
+ */
+static inline void
+matrix_project_bounds_corners (const graphene_simd4x4f_t *m,
+                               const graphene_rect_t     *r,
+                               graphene_rect_t           *res)
+{
+  graphene_simd4f_t xs, ys, a_x, a_y, a_z, t;
+
+  matrix_rect_corners (r, &xs, &ys);
+
+  a_x = graphene_simd4f_madd (xs, graphene_simd4f_splat_x (m->x),
+                              graphene_simd4f_mul (ys, graphene_simd4f_splat_x (m->y)));
+  a_y = graphene_simd4f_madd (xs, graphene_simd4f_splat_y (m->x),
+                              graphene_simd4f_mul (ys, graphene_simd4f_splat_y (m->y)));
+  a_z = graphene_simd4f_madd (xs, graphene_simd4f_splat_z (m->x),
+                              graphene_simd4f_mul (ys, graphene_simd4f_splat_z (m->y)));
+
+  /* the projection of (x, y, 0) along the direction of the z row
+   * of the matrix on the z = 0 plane
+   */
+  t = graphene_simd4f_div (a_z, graphene_simd4f_splat_z (m->z));
+  a_x = graphene_simd4f_sub (a_x, graphene_simd4f_mul (t, graphene_simd4f_splat_x (m->z)));
+  a_y = graphene_simd4f_sub (a_y, graphene_simd4f_mul (t, graphene_simd4f_splat_y (m->z)));
+
+  matrix_rect_bounds (a_x, a_y, res);
+}
+
 /**
  * graphene_matrix_project_rect_bounds:
  * @m: a #graphene_matrix_t
@@ -1117,35 +1496,48 @@ graphene_matrix_project_rect_bounds (const graphene_matrix_t *m,
                                      const graphene_rect_t   *r,
                                      graphene_rect_t         *res)
 {
-  graphene_point_t points[4];
-  graphene_point_t ret[4];
-  float min_x, min_y;
-  float max_x, max_y;
-  int i;
-
-  graphene_rect_get_top_left (r, &points[0]);
-  graphene_rect_get_top_right (r, &points[1]);
-  graphene_rect_get_bottom_left (r, &points[2]);
-  graphene_rect_get_bottom_right (r, &points[3]);
-
-  graphene_matrix_project_point (m, &points[0], &ret[0]);
-  graphene_matrix_project_point (m, &points[1], &ret[1]);
-  graphene_matrix_project_point (m, &points[2], &ret[2]);
-  graphene_matrix_project_point (m, &points[3], &ret[3]);
+  /* the corners of the rectangle are not moved off the z = 0 plane
+   * by a scale, so projecting them is the same as transforming them
+   */
+  if (graphene_matrix_is_scale_translate_internal (&m->value))
+    matrix_transform_bounds_scale (&m->value, r, res);
+  else
+    matrix_project_bounds_corners (&m->value, r, res);
+}
 
-  min_x = max_x = ret[0].x;
-  min_y = max_y = ret[0].y;
+/**
+ * graphene_matrix_project_rect_bounds_array:
+ * @m: a #graphene_matrix_t
+ * @n_rects: the number of rectangles to project
+ * @rects: (array length=n_rects): the rectangles to project
+ * @res: (out caller-allocates) (array length=n_rects): return location
+ *   for the bounds of the projected rectangles
+ *
+ * Projects an array of #graphene_rect_t using the given matrix @m,
+ * like graphene_matrix_project_rect_bounds().
+ *
+ * The @rects and @res arrays can be the same.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_project_rect_bounds_array (const graphene_matrix_t *m,
+                                           unsigned int             n_rects,
+                                           const graphene_rect_t    rects[],
+                                           graphene_rect_t          res[])
+{
+  unsigned int i;
 
-  for (i = 1; i < 4; i++)
+  if (graphene_matrix_is_scale_translate_internal (&m->value))
     {
-      min_x = MIN (ret[i].x, min_x);
-      min_y = MIN (ret[i].y, min_y);
-
-      max_x = MAX (ret[i].x, max_x);
-      max_y = MAX (ret[i].y, max_y);
+      for (i = 0; i < n_rects; i++)
+        matrix_transform_bounds_scale (&m->value, &rects[i], &res[i]);
+    }
+  else
+    {
+      for (i = 0; i < n_rects; i++)
+        matrix_project_bounds_corners (&m->value, &rects[i], &res[i]);
     }
-
-  graphene_rect_init (res, min_x, min_y, max_x - min_x, max_y - min_y);
 }
 
 /**
@@ -1272,16 +1664,107 @@ graphene_matrix_untransform_bounds (const graphene_matrix_t *m,
 }
 
 /**
- * graphene_matrix_unproject_point3d:
- * @projection: a #graphene_matrix_t for the projection matrix
- * @modelview: a #graphene_matrix_t for the modelview matrix; this is
- *   the inverse of the modelview used when projecting the point
- * @point: a #graphene_point3d_t with the coordinates of the point
- * @res: (out caller-allocates): return location for the unprojected
- *   point
+ * graphene_matrix_clip_rect:
+ * @m: a #graphene_matrix_t
+ * @r: a #graphene_rect_t, in the coordinate space of @m
+ * @clip: the current clip, in the transformed coordinate space
+ * @res: (out caller-allocates): return location for the bounds of
+ *   the intersection between @clip and the transformed @r
+ * @res_quad: (out caller-allocates) (optional): return location for
+ *   the transformed @r, if the transformation does not preserve the
+ *   axis alignment, or %NULL
+ *
+ * Transforms the rectangle @r using the matrix @m and intersects
+ * the result with the @clip rectangle; this is the operation needed
+ * when pushing a new clip on a clip stack.
+ *
+ * If @m preserves the axis alignment, as checked by
+ * graphene_matrix_preserves_axis_alignment(), the transformed
+ * rectangle is computed directly from two of its corners, and
+ * the intersection never leaves the rectangle space.
+ *
+ * Otherwise, the transformed rectangle is stored in @res_quad,
+ * and @res will contain the bounds of the intersection; the actual
+ * clip region is the intersection of @res and @res_quad.
+ *
+ * Returns: `true` if @res describes the clip region exactly, and
+ *   `false` if the clip region must be tested against @res_quad
  *
- * Unprojects the given @point using the @projection matrix and
- * a @modelview matrix.
+ * Since: 1.4
+ */
+bool
+graphene_matrix_clip_rect (const graphene_matrix_t *m,
+                           const graphene_rect_t   *r,
+                           const graphene_rect_t   *clip,
+                           graphene_rect_t         *res,
+                           graphene_quad_t         *res_quad)
+{
+  graphene_simd4f_t p_0, p_1, min_v, max_v;
+  graphene_point_t p[4];
+  graphene_quad_t q;
+  graphene_rect_t t;
+  int i;
+
+  if (graphene_matrix_preserves_axis_alignment (m))
+    {
+      p_0 = graphene_simd4f_init (r->origin.x, r->origin.y, 0.f, 0.f);
+      p_1 = graphene_simd4f_init (r->origin.x + r->size.width,
+                                  r->origin.y + r->size.height,
+                                  0.f, 0.f);
+
+      graphene_simd4x4f_point3_mul (&m->value, &p_0, &p_0);
+      graphene_simd4x4f_point3_mul (&m->value, &p_1, &p_1);
+
+      min_v = graphene_simd4f_min (p_0, p_1);
+      max_v = graphene_simd4f_max (p_0, p_1);
+
+      graphene_rect_init (&t,
+                          graphene_simd4f_get_x (min_v),
+                          graphene_simd4f_get_y (min_v),
+                          graphene_simd4f_get_x (max_v) - graphene_simd4f_get_x (min_v),
+                          graphene_simd4f_get_y (max_v) - graphene_simd4f_get_y (min_v));
+
+      graphene_rect_intersection (clip, &t, res);
+
+      return true;
+    }
+
+  graphene_rect_get_top_left (r, &p[0]);
+  graphene_rect_get_top_right (r, &p[1]);
+  graphene_rect_get_bottom_right (r, &p[2]);
+  graphene_rect_get_bottom_left (r, &p[3]);
+
+  for (i = 0; i < 4; i++)
+    {
+      p_0 = graphene_simd4f_init (p[i].x, p[i].y, 0.f, 1.f);
+      graphene_simd4x4f_vec4_mul (&m->value, &p_0, &p_0);
+      p_0 = graphene_simd4f_div (p_0, graphene_simd4f_splat_w (p_0));
+
+      p[i].x = graphene_simd4f_get_x (p_0);
+      p[i].y = graphene_simd4f_get_y (p_0);
+    }
+
+  graphene_quad_init_from_points (&q, p);
+  graphene_quad_bounds (&q, &t);
+
+  if (res_quad != NULL)
+    *res_quad = q;
+
+  /* an empty intersection is exactly representable */
+  return !graphene_rect_intersection (clip, &t, res);
+}
+
+/**
+ * graphene_matrix_unproject_point3d:
+ * @projection: a #graphene_matrix_t for the projection matrix
+ * @modelview: a #graphene_matrix_t for the modelview matrix; this is
+ *   the inverse of the modelview used when projecting the point
+ * @point: a #graphene_point3d_t with the coordinates of the point
+ * @res: (out caller-allocates): return location for the unprojected
+ *   point
+ *
+ * Unprojects the given @point using the @projection matrix and
+ * a @modelview matrix.
  *
  * Since: 1.2
  */
@@ -1325,10 +1808,7 @@ void
 graphene_matrix_translate (graphene_matrix_t        *m,
                            const graphene_point3d_t *pos)
 {
-  graphene_simd4x4f_t trans_m;
-
-  graphene_simd4x4f_translation (&trans_m, pos->x, pos->y, pos->z);
-  graphene_simd4x4f_matrix_mul (&trans_m, &m->value, &m->value);
+  graphene_matrix_translate_internal (&m->value, graphene_simd4f_init (pos->x, pos->y, pos->z, 0.f));
 }
 
 /**
@@ -1371,17 +1851,6 @@ graphene_matrix_rotate_euler (graphene_matrix_t      *m,
   graphene_matrix_rotate_quaternion (m, &q);
 }
 
-static inline void
-graphene_matrix_rotate_internal (graphene_simd4x4f_t     *m,
-                                 float                    rad,
-                                 const graphene_simd4f_t  axis)
-{
-  graphene_simd4x4f_t rot_m;
-
-  graphene_simd4x4f_rotation (&rot_m, rad, axis);
-  graphene_simd4x4f_matrix_mul (&rot_m, m, m);
-}
-
 /**
  * graphene_matrix_rotate:
  * @m: a #graphene_matrix_t
@@ -1415,8 +1884,7 @@ void
 graphene_matrix_rotate_x (graphene_matrix_t *m,
                           float              angle)
 {
-  graphene_matrix_rotate_internal (&m->value, GRAPHENE_DEG_TO_RAD (angle),
-                                   graphene_simd4f_init (1.f, 0.f, 0.f, 0.f));
+  graphene_matrix_rotate_x_internal (&m->value, GRAPHENE_DEG_TO_RAD (angle));
 }
 
 /**
@@ -1433,8 +1901,7 @@ void
 graphene_matrix_rotate_y (graphene_matrix_t *m,
                           float              angle)
 {
-  graphene_matrix_rotate_internal (&m->value, GRAPHENE_DEG_TO_RAD (angle),
-                                   graphene_simd4f_init (0.f, 1.f, 0.f, 0.f));
+  graphene_matrix_rotate_y_internal (&m->value, GRAPHENE_DEG_TO_RAD (angle));
 }
 
 /**
@@ -1451,8 +1918,7 @@ void
 graphene_matrix_rotate_z (graphene_matrix_t *m,
                           float              angle)
 {
-  graphene_matrix_rotate_internal (&m->value, GRAPHENE_DEG_TO_RAD (angle),
-                                   graphene_simd4f_init (0.f, 0.f, 1.f, 0.f));
+  graphene_matrix_rotate_z_internal (&m->value, GRAPHENE_DEG_TO_RAD (angle));
 }
 
 /**
@@ -1473,10 +1939,7 @@ graphene_matrix_scale (graphene_matrix_t *m,
                        float              factor_y,
                        float              factor_z)
 {
-  graphene_simd4x4f_t scale_m;
-
-  graphene_simd4x4f_scale (&scale_m, factor_x, factor_y, factor_z);
-  graphene_simd4x4f_matrix_mul (&scale_m, &m->value, &m->value);
+  graphene_matrix_scale_internal (&m->value, factor_x, factor_y, factor_z);
 }
 
 /**
@@ -1574,6 +2037,138 @@ graphene_matrix_transpose (const graphene_matrix_t *m,
   graphene_simd4x4f_transpose (&m->value, &res->value);
 }
 
+/*< private >
+ * matrix_inverse_scale_translate:
+ * @m: a scale and translation #graphene_simd4x4f_t
+ * @res: (out): return location for the inverse
+ *
+ * Inverts @m by taking the reciprocal of its diagonal, and scaling
+ * the negated translation by it.
+ *
+ * Returns: `false` if one of the scale factors is zero
+ */
+static inline bool
+matrix_inverse_scale_translate (const graphene_simd4x4f_t *m,
+                                graphene_simd4x4f_t       *res)
+{
+  float s_x = graphene_simd4f_get_x (m->x);
+  float s_y = graphene_simd4f_get_y (m->y);
+  float s_z = graphene_simd4f_get_z (m->z);
+  graphene_simd4f_t inv_scale;
+
+  if (s_x == 0.f || s_y == 0.f || s_z == 0.f)
+    return false;
+
+  inv_scale = graphene_simd4f_div (graphene_simd4f_splat (1.f),
+                                   graphene_simd4f_init (s_x, s_y, s_z, 1.f));
+
+  res->x = graphene_simd4f_mul (inv_scale, graphene_simd4f_init (1.f, 0.f, 0.f, 0.f));
+  res->y = graphene_simd4f_mul (inv_scale, graphene_simd4f_init (0.f, 1.f, 0.f, 0.f));
+  res->z = graphene_simd4f_mul (inv_scale, graphene_simd4f_init (0.f, 0.f, 1.f, 0.f));
+  res->w = graphene_simd4f_merge_w (graphene_simd4f_neg (graphene_simd4f_mul (m->w, inv_scale)), 1.f);
+
+  return true;
+}
+
+/*< private >
+ * matrix_inverse_rigid:
+ * @m: a rigid #graphene_simd4x4f_t
+ * @res: (out): return location for the inverse
+ *
+ * Inverts @m by transposing its rotation, and applying the inverse
+ * rotation to the negated translation.
+ */
+static inline void
+matrix_inverse_rigid (const graphene_simd4x4f_t *m,
+                      graphene_simd4x4f_t       *res)
+{
+  const graphene_simd4f_t origin = graphene_simd4f_init_zero ();
+  graphene_simd4x4f_t rotation = *m;
+  graphene_simd4f_t translation;
+
+  graphene_simd4x4f_inv_ortho_point3_mul (m, &origin, &translation);
+
+  rotation.w = graphene_simd4f_init_zero ();
+  graphene_simd4x4f_transpose_in_place (&rotation);
+
+  res->x = rotation.x;
+  res->y = rotation.y;
+  res->z = rotation.z;
+  res->w = graphene_simd4f_merge_w (translation, 1.f);
+}
+
+/*< private >
+ * matrix_normal_matrix:
+ * @m: a #graphene_simd4x4f_t
+ * @res: (out): return location for the normal matrix
+ *
+ * Computes the inverse transpose of the upper 3x3 component of @m, that
+ * is its cofactor matrix divided by its determinant; the rows of the
+ * cofactor matrix are the cross products of the rows of @m, and the
+ * determinant is the dot product of the first row with its cofactors,
+ * so the only division is the reciprocal of the determinant.
+ *
+ * The last row and the last column of @res are set to zero.
+ *
+ * Returns: `false` if the upper 3x3 component is singular
+ */
+static inline bool
+matrix_normal_matrix (const graphene_simd4x4f_t *m,
+                      graphene_simd4x4f_t       *res)
+{
+  graphene_simd4f_t c_x, c_y, c_z, det;
+
+  c_x = graphene_simd4f_cross3 (m->y, m->z);
+  c_y = graphene_simd4f_cross3 (m->z, m->x);
+  c_z = graphene_simd4f_cross3 (m->x, m->y);
+
+  det = graphene_simd4f_dot3 (m->x, c_x);
+  if (graphene_simd4f_get_x (det) == 0.f)
+    return false;
+
+  det = graphene_simd4f_div (graphene_simd4f_splat (1.f), det);
+
+  res->x = graphene_simd4f_zero_w (graphene_simd4f_mul (c_x, det));
+  res->y = graphene_simd4f_zero_w (graphene_simd4f_mul (c_y, det));
+  res->z = graphene_simd4f_zero_w (graphene_simd4f_mul (c_z, det));
+  res->w = graphene_simd4f_init_zero ();
+
+  return true;
+}
+
+/*< private >
+ * matrix_inverse_affine:
+ * @m: an affine #graphene_simd4x4f_t
+ * @res: (out): return location for the inverse
+ *
+ * Inverts the upper 3x3 component of @m by transposing its normal
+ * matrix, and applies the inverse to the negated translation.
+ *
+ * Returns: `false` if the upper 3x3 component is singular
+ */
+static inline bool
+matrix_inverse_affine (const graphene_simd4x4f_t *m,
+                       graphene_simd4x4f_t       *res)
+{
+  graphene_simd4x4f_t inverse;
+  graphene_simd4f_t translation;
+
+  if (!matrix_normal_matrix (m, &inverse))
+    return false;
+
+  graphene_simd4x4f_transpose_in_place (&inverse);
+
+  translation = graphene_simd4f_neg (m->w);
+  graphene_simd4x4f_vec3_mul (&inverse, &translation, &translation);
+
+  res->x = inverse.x;
+  res->y = inverse.y;
+  res->z = inverse.z;
+  res->w = graphene_simd4f_merge_w (translation, 1.f);
+
+  return true;
+}
+
 /**
  * graphene_matrix_inverse:
  * @m: a #graphene_matrix_t
@@ -1582,6 +2177,12 @@ graphene_matrix_transpose (const graphene_matrix_t *m,
  *
  * Inverts the given matrix.
  *
+ * The inverse is computed using the cheapest method for the kind
+ * of transformation described by @m: matrices without perspective
+ * are inverted using graphene_matrix_inverse_rigid() or
+ * graphene_matrix_inverse_affine(), or, if they only contain a scale
+ * and a translation, by taking the reciprocal of their diagonal.
+ *
  * Returns: `true` if the matrix is invertible
  *
  * Since: 1.0
@@ -1590,7 +2191,153 @@ bool
 graphene_matrix_inverse (const graphene_matrix_t *m,
                          graphene_matrix_t       *res)
 {
-  return graphene_simd4x4f_inverse (&m->value, &res->value);
+  if (!graphene_matrix_is_affine_internal (&m->value))
+    return graphene_simd4x4f_inverse (&m->value, &res->value);
+
+  if (graphene_matrix_is_scale_translate_internal (&m->value))
+    return matrix_inverse_scale_translate (&m->value, &res->value);
+
+  if (graphene_matrix_is_rigid_internal (&m->value))
+    {
+      matrix_inverse_rigid (&m->value, &res->value);
+      return true;
+    }
+
+  return matrix_inverse_affine (&m->value, &res->value);
+}
+
+/**
+ * graphene_matrix_inverse_affine:
+ * @m: a #graphene_matrix_t
+ * @res: (out caller-allocates): return location for the
+ *   inverse matrix
+ *
+ * Inverts a matrix without perspective, that is a matrix whose last
+ * column is (0, 0, 0, 1), by inverting its upper 3x3 component and
+ * applying the result to the translation.
+ *
+ * If @m has a perspective component, this function falls back to
+ * the inversion of the whole matrix.
+ *
+ * Returns: `true` if the matrix is invertible
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_inverse_affine (const graphene_matrix_t *m,
+                                graphene_matrix_t       *res)
+{
+  if (!graphene_matrix_is_affine_internal (&m->value))
+    return graphene_simd4x4f_inverse (&m->value, &res->value);
+
+  return matrix_inverse_affine (&m->value, &res->value);
+}
+
+/**
+ * graphene_matrix_inverse_rigid:
+ * @m: a #graphene_matrix_t
+ * @res: (out caller-allocates): return location for the
+ *   inverse matrix
+ *
+ * Inverts a rigid transformation matrix, that is a matrix composed
+ * only of a rotation and a translation, by transposing the rotation
+ * and applying it to the negated translation. This does not require
+ * any division.
+ *
+ * If the upper 3x3 component of @m is not orthonormal, or if @m has
+ * a perspective component, this function falls back to
+ * graphene_matrix_inverse_affine().
+ *
+ * Returns: `true` if the matrix is invertible
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_inverse_rigid (const graphene_matrix_t *m,
+                               graphene_matrix_t       *res)
+{
+  if (!(graphene_matrix_is_affine_internal (&m->value) && graphene_matrix_is_rigid_internal (&m->value)))
+    return graphene_matrix_inverse_affine (m, res);
+
+  matrix_inverse_rigid (&m->value, &res->value);
+
+  return true;
+}
+
+/**
+ * graphene_matrix_get_normal_matrix:
+ * @m: a #graphene_matrix_t
+ * @res: (out caller-allocates): return location for the normal matrix
+ *
+ * Computes the matrix used to transform the normal vectors of a surface
+ * transformed by @m, that is the inverse transpose of the upper 3x3
+ * component of @m; the translation and the perspective components of
+ * @m are ignored, and the last row and column of @res are set to those
+ * of the identity matrix.
+ *
+ * This is equivalent to calling graphene_matrix_inverse() followed by
+ * graphene_matrix_transpose() on the upper 3x3 component of @m, but it
+ * computes the cofactors of @m directly from the cross products of its
+ * rows, and only requires the reciprocal of the determinant.
+ *
+ * Returns: `true` if the upper 3x3 component of @m is invertible
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_get_normal_matrix (const graphene_matrix_t *m,
+                                   graphene_matrix_t       *res)
+{
+  graphene_simd4x4f_t n;
+
+  if (!matrix_normal_matrix (&m->value, &n))
+    return false;
+
+  n.w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  res->value = n;
+
+  return true;
+}
+
+/**
+ * graphene_matrix_get_normal_matrix_array:
+ * @n_matrices: the number of matrices
+ * @m: (array length=n_matrices): an array of #graphene_matrix_t
+ * @res: (array length=n_matrices) (out caller-allocates): return
+ *   location for the normal matrices
+ *
+ * Computes the normal matrix of each matrix in the @m array; see
+ * graphene_matrix_get_normal_matrix().
+ *
+ * The normal matrix of a singular matrix is set to the identity.
+ *
+ * Returns: the number of singular matrices in @m
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_matrix_get_normal_matrix_array (unsigned int            n_matrices,
+                                         const graphene_matrix_t m[],
+                                         graphene_matrix_t       res[])
+{
+  unsigned int i, n_singular = 0;
+
+  for (i = 0; i < n_matrices; i++)
+    {
+      graphene_simd4x4f_t n;
+
+      if (matrix_normal_matrix (&m[i].value, &n))
+        n.w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+      else
+        {
+          graphene_simd4x4f_init_identity (&n);
+          n_singular += 1;
+        }
+
+      res[i].value = n;
+    }
+
+  return n_singular;
 }
 
 /**
@@ -1717,262 +2464,538 @@ graphene_matrix_get_z_scale (const graphene_matrix_t *m)
 #define XZ_SHEAR        1
 #define YZ_SHEAR        2
 
+/*< private >
+ * matrix_decompose_2d:
+ *
+ * Decomposes a 2D affine matrix into its translation, scale, shear,
+ * and rotation; all the components are stored in SIMD vectors, with
+ * the rotation stored as a quaternion around the Z axis.
+ */
 static bool
 matrix_decompose_2d (const graphene_matrix_t *m,
-                     graphene_point3d_t      *scale_r,
-                     float                    shear_r[3],
-                     graphene_quaternion_t   *rotate_r,
-                     graphene_point3d_t      *translate_r)
-{
-  float A = graphene_matrix_get_value (m, 0, 0);
-  float B = graphene_matrix_get_value (m, 1, 0);
-  float C = graphene_matrix_get_value (m, 0, 1);
-  float D = graphene_matrix_get_value (m, 1, 1);
-  float scale_x, scale_y;
-  float shear_xy;
-  float rotate;
-
-  if (A * D == B * C)
+                     graphene_simd4f_t       *translate_r,
+                     graphene_simd4f_t       *scale_r,
+                     graphene_simd4f_t       *shear_r,
+                     graphene_simd4f_t       *rotate_r)
+{
+  graphene_simd4f_t row_x, row_y, scale_x, scale_y, shear_xy;
+  float det, rotate, s, c;
+
+  row_x = graphene_simd4f_zero_zw (m->value.x);
+  row_y = graphene_simd4f_zero_zw (m->value.y);
+
+  det = graphene_simd4f_get_x (row_x) * graphene_simd4f_get_y (row_y)
+      - graphene_simd4f_get_y (row_x) * graphene_simd4f_get_x (row_y);
+  if (det == 0.f)
     return false;
 
-  scale_x = sqrtf (A * A + B * B);
-  A /= scale_x;
-  B /= scale_x;
+  /* compute the X scale factor and normalize the first row */
+  scale_x = graphene_simd4f_length2 (row_x);
+  row_x = graphene_simd4f_div (row_x, scale_x);
 
-  shear_xy = A * C + B * D;
-  C -= A * shear_xy;
-  D -= B * shear_xy;
+  /* compute the shear factor and make the second row orthogonal */
+  shear_xy = graphene_simd4f_dot2 (row_x, row_y);
+  row_y = graphene_simd4f_sub (row_y, graphene_simd4f_mul (row_x, shear_xy));
 
-  scale_y = sqrtf (C * C + D * D);
-  C /= scale_y;
-  D /= scale_y;
-  shear_xy /= scale_y;
+  /* compute the Y scale factor and normalize the second row */
+  scale_y = graphene_simd4f_length2 (row_y);
+  shear_xy = graphene_simd4f_div (shear_xy, scale_y);
 
-  if (A * D < B * C)
+  /* normalizing the rows does not change the sign of the determinant;
+   * if the matrix contains a reflection, we flip the first row so that
+   * the remaining part is a rotation
+   */
+  if (det < 0.f)
     {
-      A = -A;
-      B = -B;
-      C = -C;
-      D = -D;
-
-      shear_xy = -shear_xy;
-      scale_x = -scale_x;
+      row_x = graphene_simd4f_neg (row_x);
+      scale_x = graphene_simd4f_neg (scale_x);
+      shear_xy = graphene_simd4f_neg (shear_xy);
     }
 
-  rotate = atan2f (B, A);
-  graphene_quaternion_init (rotate_r, 0.f, 0.f, sin (rotate / 2.f), cos (rotate / 2.f));
-
-  shear_r[XY_SHEAR] = shear_xy;
-  graphene_point3d_init (scale_r, scale_x, scale_y, 1.f);
+  rotate = atan2f (graphene_simd4f_get_y (row_x), graphene_simd4f_get_x (row_x));
+  graphene_sincos (rotate / 2.f, &s, &c);
 
-  graphene_point3d_init (translate_r,
-                         graphene_matrix_get_value (m, 3, 0),
-                         graphene_matrix_get_value (m, 3, 1),
-                         0.f);
+  *translate_r = graphene_simd4f_zero_zw (m->value.w);
+  *scale_r = graphene_simd4f_init (graphene_simd4f_get_x (scale_x), graphene_simd4f_get_x (scale_y), 1.f, 0.f);
+  *shear_r = graphene_simd4f_init (graphene_simd4f_get_x (shear_xy), 0.f, 0.f, 0.f);
+  *rotate_r = graphene_simd4f_init (0.f, 0.f, s, c);
 
   return true;
 }
 
+/*< private >
+ * matrix_decompose_3d:
+ *
+ * Decomposes a 3D matrix into its translation, scale, shear, rotation
+ * and perspective; all the components are stored in SIMD vectors, with
+ * the rotation stored as a quaternion.
+ *
+ * Since the translation is stored in the last row of the matrix, the
+ * perspective partition is the last column; if the last column is
+ * (0, 0, 0, 1), which is the common case for affine transformations,
+ * we can skip solving for the perspective.
+ */
 static bool
 matrix_decompose_3d (const graphene_matrix_t *m,
-                     graphene_point3d_t      *scale_r,
-                     float                    shear_r[3],
-                     graphene_quaternion_t   *rotate_r,
-                     graphene_point3d_t      *translate_r,
-                     graphene_vec4_t         *perspective_r)
-{
-  graphene_matrix_t local, perspective;
-  float shear_xy, shear_xz, shear_yz;
-  float scale_x, scale_y, scale_z;
-  graphene_simd4f_t cross;
-
-  if (graphene_matrix_get_value (m, 3, 3) == 0.f)
-    return false;
+                     graphene_simd4f_t       *translate_r,
+                     graphene_simd4f_t       *scale_r,
+                     graphene_simd4f_t       *shear_r,
+                     graphene_simd4f_t       *rotate_r,
+                     graphene_simd4f_t       *perspective_r)
+{
+  graphene_simd4f_t row_x, row_y, row_z, row_w, n, cross, det;
+  graphene_simd4f_t scale_x, scale_y, scale_z;
+  graphene_simd4f_t shear_xy, shear_xz, shear_yz;
+  const graphene_simd4f_t unit_x = graphene_simd4f_init (1.f, 0.f, 0.f, 0.f);
+  const graphene_simd4f_t unit_y = graphene_simd4f_init (0.f, 1.f, 0.f, 0.f);
+  const graphene_simd4f_t unit_z = graphene_simd4f_init (0.f, 0.f, 1.f, 0.f);
+  graphene_simd4x4f_t rotation;
+  float ww;
 
-  local = *m;
+  ww = graphene_simd4f_get_w (m->value.w);
+  if (ww == 0.f)
+    return false;
 
   /* normalize the matrix */
-  graphene_matrix_normalize (&local, &local);
-
-  /* perspective is used to solve for the perspective component,
-   * but it also provides an easy way to test for singularity of
-   * the upper 3x3 component
-   */
-  perspective = local;
-  perspective.value.w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
-
-  if (graphene_matrix_determinant (&perspective) == 0.f)
+  n = graphene_simd4f_splat (1.f / ww);
+  row_x = graphene_simd4f_mul (m->value.x, n);
+  row_y = graphene_simd4f_mul (m->value.y, n);
+  row_z = graphene_simd4f_mul (m->value.z, n);
+  row_w = graphene_simd4f_mul (m->value.w, n);
+
+  /* the upper 3x3 component must not be singular */
+  cross = graphene_simd4f_cross3 (row_y, row_z);
+  det = graphene_simd4f_dot3 (row_x, cross);
+  if (graphene_simd4f_get_x (det) == 0.f)
     return false;
 
   /* isolate the perspective */
-  if (graphene_simd4f_is_zero3 (local.value.w))
+  if (graphene_simd4f_get_w (row_x) != 0.f ||
+      graphene_simd4f_get_w (row_y) != 0.f ||
+      graphene_simd4f_get_w (row_z) != 0.f)
     {
-      graphene_matrix_t tmp;
+      graphene_matrix_t perspective, inverse;
+      graphene_vec4_t rhs;
 
-      /* perspective_r is the right hand side of the equation */
-      perspective_r->value = local.value.w;
-
-      /* solve the equation by inverting perspective and multiplying
-       * the inverse with the perspective vector; we don't need to
-       * check if the matrix is invertible here because we just checked
-       * whether the determinant is not zero.
+      /* the right hand side of the equation is the last column, and
+       * we solve it by multiplying it with the inverse of the matrix
+       * without its perspective partition; we don't need to check if
+       * the matrix is invertible, as we just checked the determinant
        */
-      graphene_matrix_inverse (&perspective, &tmp);
-      graphene_matrix_transpose_transform_vec4 (&tmp, perspective_r, perspective_r);
+      graphene_vec4_init (&rhs,
+                          graphene_simd4f_get_w (row_x),
+                          graphene_simd4f_get_w (row_y),
+                          graphene_simd4f_get_w (row_z),
+                          1.f);
+
+      perspective.value.x = graphene_simd4f_zero_w (row_x);
+      perspective.value.y = graphene_simd4f_zero_w (row_y);
+      perspective.value.z = graphene_simd4f_zero_w (row_z);
+      perspective.value.w = graphene_simd4f_merge_w (row_w, 1.f);
+
+      graphene_matrix_inverse (&perspective, &inverse);
+      graphene_matrix_transpose_transform_vec4 (&inverse, &rhs, &rhs);
 
-      /* clear the perspective partition */
-      local.value.w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+      *perspective_r = rhs.value;
     }
   else
-    graphene_vec4_init (perspective_r, 0.f, 0.f, 0.f, 1.f);
+    *perspective_r = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
 
   /* next, take care of the translation partition */
-  translate_r->x = graphene_simd4f_get_x (local.value.w);
-  translate_r->y = graphene_simd4f_get_y (local.value.w);
-  translate_r->z = graphene_simd4f_get_z (local.value.w);
-  local.value.w = graphene_simd4f_init (0.f, 0.f, 0.f, graphene_simd4f_get_w (local.value.w));
+  *translate_r = graphene_simd4f_zero_w (row_w);
 
   /* now get scale and shear */
+  row_x = graphene_simd4f_zero_w (row_x);
+  row_y = graphene_simd4f_zero_w (row_y);
+  row_z = graphene_simd4f_zero_w (row_z);
 
   /* compute the X scale factor and normalize the first row */
-  scale_x = graphene_simd4f_get_x (graphene_simd4f_length4 (local.value.x));
-  local.value.x = graphene_simd4f_normalize4 (local.value.x);
+  scale_x = graphene_simd4f_length3 (row_x);
+  row_x = graphene_simd4f_div (row_x, scale_x);
 
-  /* compute XY shear factor and the second row orthogonal to the first */
-  shear_xy = graphene_simd4f_get_x (graphene_simd4f_dot4 (local.value.x, local.value.y));
-  local.value.y = graphene_simd4f_sub (local.value.y, graphene_simd4f_mul (local.value.x, graphene_simd4f_splat (shear_xy)));
+  /* compute XY shear factor and make the second row orthogonal to the first */
+  shear_xy = graphene_simd4f_dot3 (row_x, row_y);
+  row_y = graphene_simd4f_sub (row_y, graphene_simd4f_mul (row_x, shear_xy));
 
   /* now, compute the Y scale factor and normalize the second row */
-  scale_y = graphene_simd4f_get_x (graphene_simd4f_length4 (local.value.y));
-  local.value.y = graphene_simd4f_normalize4 (local.value.y);
-  shear_xy /= scale_y;
+  scale_y = graphene_simd4f_length3 (row_y);
+  row_y = graphene_simd4f_div (row_y, scale_y);
+  shear_xy = graphene_simd4f_div (shear_xy, scale_y);
 
   /* compute XZ and YZ shears, make the third row orthogonal */
-  shear_xz = graphene_simd4f_get_x (graphene_simd4f_dot4 (local.value.x, local.value.z));
-  local.value.z = graphene_simd4f_sub (local.value.z, graphene_simd4f_mul (local.value.x, graphene_simd4f_splat (shear_xz)));
-  shear_yz = graphene_simd4f_get_x (graphene_simd4f_dot4 (local.value.y, local.value.z));
-  local.value.z = graphene_simd4f_sub (local.value.z, graphene_simd4f_mul (local.value.y, graphene_simd4f_splat (shear_yz)));
+  shear_xz = graphene_simd4f_dot3 (row_x, row_z);
+  row_z = graphene_simd4f_sub (row_z, graphene_simd4f_mul (row_x, shear_xz));
+  shear_yz = graphene_simd4f_dot3 (row_y, row_z);
+  row_z = graphene_simd4f_sub (row_z, graphene_simd4f_mul (row_y, shear_yz));
 
   /* next, get the Z scale and normalize the third row */
-  scale_z = graphene_simd4f_get_x (graphene_simd4f_length4 (local.value.z));
-  local.value.z = graphene_simd4f_normalize4 (local.value.z);
+  scale_z = graphene_simd4f_length3 (row_z);
+  row_z = graphene_simd4f_div (row_z, scale_z);
+  shear_xz = graphene_simd4f_div (shear_xz, scale_z);
+  shear_yz = graphene_simd4f_div (shear_yz, scale_z);
 
-  shear_xz /= scale_z;
-  shear_yz /= scale_z;
-
-  shear_r[XY_SHEAR] = shear_xy;
-  shear_r[XZ_SHEAR] = shear_xz;
-  shear_r[YZ_SHEAR] = shear_yz;
+  /* the scale and shear factors are splatted, so we can pack them
+   * in a single vector by masking each with a unit vector
+   */
+  *scale_r = graphene_simd4f_madd (scale_z, unit_z,
+                                   graphene_simd4f_madd (scale_y, unit_y,
+                                                         graphene_simd4f_mul (scale_x, unit_x)));
+  *shear_r = graphene_simd4f_madd (shear_yz, unit_z,
+                                   graphene_simd4f_madd (shear_xz, unit_y,
+                                                         graphene_simd4f_mul (shear_xy, unit_x)));
 
   /* at this point, the matrix is orthonormal. we check for a
    * coordinate system flip. if the determinant is -1, then
    * negate the matrix and the scaling factors
    */
-  cross = graphene_simd4f_dot4 (local.value.x, graphene_simd4f_cross3 (local.value.y, local.value.z));
-  if (graphene_simd4f_get_x (cross) < 0.f)
+  if (graphene_simd4f_get_x (det) < 0.f)
     {
-      scale_x *= -1.f;
-      scale_y *= -1.f;
-      scale_z *= -1.f;
+      *scale_r = graphene_simd4f_neg (*scale_r);
 
-      local.value.x = graphene_simd4f_neg (local.value.x);
-      local.value.y = graphene_simd4f_neg (local.value.y);
-      local.value.z = graphene_simd4f_neg (local.value.z);
+      row_x = graphene_simd4f_neg (row_x);
+      row_y = graphene_simd4f_neg (row_y);
+      row_z = graphene_simd4f_neg (row_z);
     }
 
-  graphene_point3d_init (scale_r, scale_x, scale_y, scale_z);
-
   /* get the rotations out */
-  graphene_quaternion_init_from_matrix (rotate_r, &local);
+  rotation = graphene_simd4x4f_init (row_x, row_y, row_z,
+                                     graphene_simd4f_init (0.f, 0.f, 0.f, 1.f));
+  *rotate_r = graphene_quaternion_simd_from_matrix (&rotation);
 
   return true;
 }
 
+static bool
+matrix_decompose (const graphene_matrix_t *m,
+                  bool                     is_2d,
+                  graphene_simd4f_t       *translate_r,
+                  graphene_simd4f_t       *scale_r,
+                  graphene_simd4f_t       *shear_r,
+                  graphene_simd4f_t       *perspective_r,
+                  graphene_simd4f_t       *rotate_r)
+{
+  if (is_2d)
+    {
+      *perspective_r = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+
+      return matrix_decompose_2d (m, translate_r, scale_r, shear_r, rotate_r);
+    }
+
+  return matrix_decompose_3d (m, translate_r, scale_r, shear_r, rotate_r, perspective_r);
+}
+
 /**
- * graphene_matrix_interpolate:
- * @a: a #graphene_matrix_t
- * @b: a #graphene_matrix_t
- * @factor: the linear interpolation factor
- * @res: (out caller-allocates): return location for the
- *   interpolated matrix
+ * graphene_matrix_decompose:
+ * @m: a #graphene_matrix_t
+ * @translate: (out caller-allocates): the translation vector
+ * @scale: (out caller-allocates): the scale vector
+ * @rotate: (out caller-allocates): the rotation quaternion
+ * @shear: (out caller-allocates): the shear vector, containing the
+ *   XY, XZ, and YZ shear factors
+ * @perspective: (out caller-allocates): the perspective vector
  *
- * Linearly interpolates the two given #graphene_matrix_t by
- * interpolating the decomposed transformations separately.
+ * Decomposes a transformation matrix into its component transformations.
  *
- * If either matrix cannot be reduced to their transformations
- * then the interpolation cannot be performed, and this function
- * will return an identity matrix.
+ * The algorithm for decomposing a matrix is taken from the
+ * [CSS3 Transforms specification](http://dev.w3.org/csswg/css-transforms/);
+ * specifically, the decomposition code is based on the equivalent code
+ * published in "Graphics Gems II", edited by Jim Arvo.
  *
- * Since: 1.0
+ * If @m is a 2D transformation, see graphene_matrix_is_2d(), the
+ * 2D decomposition is used.
+ *
+ * Returns: `true` if the matrix could be decomposed
+ *
+ * Since: 1.4
  */
-void
-graphene_matrix_interpolate (const graphene_matrix_t *a,
-                             const graphene_matrix_t *b,
-                             double                   factor,
-                             graphene_matrix_t       *res)
-{
-  graphene_point3d_t scale_a = { 1.f, 1.f, 1.f }, translate_a;
-  graphene_quaternion_t rotate_a;
-  float shear_a[3] = { 0.f, 0.f, 0.f };
+bool
+graphene_matrix_decompose (const graphene_matrix_t *m,
+                           graphene_vec3_t         *translate,
+                           graphene_vec3_t         *scale,
+                           graphene_quaternion_t   *rotate,
+                           graphene_vec3_t         *shear,
+                           graphene_vec4_t         *perspective)
+{
+  graphene_simd4f_t translate_v, scale_v, shear_v, perspective_v, rotate_v;
+
+  if (!matrix_decompose (m, graphene_matrix_is_2d (m),
+                         &translate_v,
+                         &scale_v,
+                         &shear_v,
+                         &perspective_v,
+                         &rotate_v))
+    return false;
 
-  graphene_point3d_t scale_b = { 1.f, 1.f, 1.f }, translate_b;
-  graphene_quaternion_t rotate_b;
-  float shear_b[3] = { 0.f, 0.f, 0.f };
+  translate->value = translate_v;
+  scale->value = scale_v;
+  shear->value = shear_v;
+  perspective->value = perspective_v;
 
-  graphene_point3d_t scale_r = { 1.f, 1.f, 1.f }, translate_r;
-  graphene_quaternion_t rotate_r;
-  float shear;
+  graphene_quaternion_store (rotate_v, rotate);
 
-  bool success = false;
+  return true;
+}
 
-  if (graphene_matrix_is_2d (a) &&
-      graphene_matrix_is_2d (b))
-    {
-      success |= matrix_decompose_2d (a, &scale_a, shear_a, &rotate_a, &translate_a);
-      success |= matrix_decompose_2d (b, &scale_b, shear_b, &rotate_b, &translate_b);
+/**
+ * graphene_matrix_interpolator_alloc: (constructor)
+ *
+ * Allocates a new #graphene_matrix_interpolator_t.
+ *
+ * The contents of the returned structure are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_matrix_interpolator_t.
+ *   Use graphene_matrix_interpolator_free() to free the resources allocated
+ *   by this function
+ *
+ * Since: 1.4
+ */
+graphene_matrix_interpolator_t *
+graphene_matrix_interpolator_alloc (void)
+{
+  return graphene_aligned_alloc (sizeof (graphene_matrix_interpolator_t), 1, 16);
+}
 
+/**
+ * graphene_matrix_interpolator_free:
+ * @i: a #graphene_matrix_interpolator_t
+ *
+ * Frees the resources allocated by graphene_matrix_interpolator_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_interpolator_free (graphene_matrix_interpolator_t *i)
+{
+  graphene_aligned_free (i);
+}
+
+/**
+ * graphene_matrix_interpolator_init:
+ * @i: the #graphene_matrix_interpolator_t to initialize
+ * @a: the start of the interpolation
+ * @b: the end of the interpolation
+ *
+ * Initializes a #graphene_matrix_interpolator_t by decomposing the
+ * two given #graphene_matrix_t into their transformations.
+ *
+ * The decomposition is performed only once, so the interpolator can
+ * be used to compute any number of interpolated matrices at the cost
+ * of recomposing the transformations.
+ *
+ * If either matrix cannot be decomposed, the interpolator will
+ * return an identity matrix; you can use
+ * graphene_matrix_interpolator_is_valid() to check for this case.
+ *
+ * Returns: (transfer none): the initialized interpolator
+ *
+ * Since: 1.4
+ */
+graphene_matrix_interpolator_t *
+graphene_matrix_interpolator_init (graphene_matrix_interpolator_t *i,
+                                   const graphene_matrix_t        *a,
+                                   const graphene_matrix_t        *b)
+{
+  bool is_2d = graphene_matrix_is_2d (a) && graphene_matrix_is_2d (b);
+  float dot;
+
+  i->is_valid =
+    matrix_decompose (a, is_2d, &i->translate[0], &i->scale[0], &i->shear[0], &i->perspective[0], &i->rotate[0]) &&
+    matrix_decompose (b, is_2d, &i->translate[1], &i->scale[1], &i->shear[1], &i->perspective[1], &i->rotate[1]);
+
+  if (!i->is_valid)
+    return i;
+
+  i->has_perspective =
+    !graphene_simd4f_is_zero3 (i->perspective[0]) ||
+    !graphene_simd4f_is_zero3 (i->perspective[1]);
+
+  /* store the deltas, so that each interpolation is a single madd */
+  i->translate[1] = graphene_simd4f_sub (i->translate[1], i->translate[0]);
+  i->scale[1] = graphene_simd4f_sub (i->scale[1], i->scale[0]);
+  i->shear[1] = graphene_simd4f_sub (i->shear[1], i->shear[0]);
+  i->perspective[1] = graphene_simd4f_sub (i->perspective[1], i->perspective[0]);
+
+  /* the angle between the rotations is constant, so we only need
+   * to evaluate the sine and cosine of the fraction of it at each
+   * interpolation step; this is the same as graphene_quaternion_slerp()
+   */
+  dot = CLAMP (graphene_simd4f_get_x (graphene_simd4f_dot4 (i->rotate[0], i->rotate[1])), -1.f, 1.f);
+  if (dot == 1.f)
+    {
+      i->theta = 0.f;
+      i->r_sin_theta = 0.f;
     }
   else
     {
-      graphene_vec4_t perspective_a;
-      graphene_vec4_t perspective_b;
+      i->theta = acosf (dot);
+      i->r_sin_theta = 1.f / sqrtf (1.f - dot * dot);
+    }
 
-      success |= matrix_decompose_3d (a, &scale_a, shear_a, &rotate_a, &translate_a, &perspective_a);
-      success |= matrix_decompose_3d (b, &scale_b, shear_b, &rotate_b, &translate_b, &perspective_b);
+  i->cos_theta = dot;
 
-      res->value.w = graphene_simd4f_interpolate (perspective_a.value,
-                                                  perspective_b.value,
-                                                  factor);
-    }
+  return i;
+}
+
+/**
+ * graphene_matrix_interpolator_is_valid:
+ * @i: a #graphene_matrix_interpolator_t
+ *
+ * Checks whether both matrices used to initialize @i could be
+ * decomposed into their transformations.
+ *
+ * Returns: `true` if the interpolator is valid
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix_interpolator_is_valid (const graphene_matrix_interpolator_t *i)
+{
+  return i->is_valid;
+}
+
+static inline void
+matrix_interpolator_recompose (const graphene_matrix_interpolator_t *i,
+                               float                                 factor,
+                               graphene_matrix_t                    *res)
+{
+  graphene_simd4f_t f, translate, scale, shear, perspective, rotate;
+  graphene_quaternion_t q;
 
-  /* If we cannot decompose either matrix we bail out with an identity */
-  if (!success)
+  if (!i->is_valid)
     {
       graphene_matrix_init_identity (res);
       return;
     }
 
-  graphene_point3d_interpolate (&translate_a, &translate_b, factor, &translate_r);
-  graphene_matrix_translate (res, &translate_r);
+  f = graphene_simd4f_splat (factor);
+  translate = graphene_simd4f_madd (i->translate[1], f, i->translate[0]);
+  scale = graphene_simd4f_madd (i->scale[1], f, i->scale[0]);
+  shear = graphene_simd4f_madd (i->shear[1], f, i->shear[0]);
+  perspective = graphene_simd4f_madd (i->perspective[1], f, i->perspective[0]);
+
+  if (i->theta == 0.f)
+    rotate = i->rotate[0];
+  else
+    {
+      float sin_v, cos_v, right_v, left_v;
+
+      graphene_sincos (factor * i->theta, &sin_v, &cos_v);
+      right_v = sin_v * i->r_sin_theta;
+      left_v = cos_v - i->cos_theta * right_v;
 
-  graphene_quaternion_slerp (&rotate_a, &rotate_b, factor, &rotate_r);
-  graphene_matrix_rotate_quaternion (res, &rotate_r);
+      rotate = graphene_simd4f_madd (i->rotate[0], graphene_simd4f_splat (left_v),
+                                     graphene_simd4f_mul (i->rotate[1], graphene_simd4f_splat (right_v)));
+    }
 
-  shear = graphene_lerp (shear_a[YZ_SHEAR], shear_b[YZ_SHEAR], factor);
-  if (shear != 0.f)
-    graphene_matrix_skew_yz (res, shear);
+  graphene_quaternion_store (rotate, &q);
+  graphene_quaternion_to_matrix (&q, res);
 
-  shear = graphene_lerp (shear_a[XZ_SHEAR], shear_b[XZ_SHEAR], factor);
-  if (shear != 0.f)
-    graphene_matrix_skew_xz (res, shear);
+  /* the operations are applied directly on the rows: the rotation has
+   * no translation, so the translation only affects the last row, while
+   * shearing and scaling only affect the first three rows
+   */
+  res->value.w = graphene_simd4f_merge_w (translate, 1.f);
+
+  res->value.z = graphene_simd4f_madd (res->value.y, graphene_simd4f_splat_z (shear), res->value.z);
+  res->value.z = graphene_simd4f_madd (res->value.x, graphene_simd4f_splat_y (shear), res->value.z);
+  res->value.y = graphene_simd4f_madd (res->value.x, graphene_simd4f_splat_x (shear), res->value.y);
+
+  res->value.x = graphene_simd4f_mul (res->value.x, graphene_simd4f_splat_x (scale));
+  res->value.y = graphene_simd4f_mul (res->value.y, graphene_simd4f_splat_y (scale));
+  res->value.z = graphene_simd4f_mul (res->value.z, graphene_simd4f_splat_z (scale));
+
+  /* the perspective is the last column of the matrix */
+  if (i->has_perspective)
+    {
+      graphene_simd4x4f_t p;
 
-  shear = graphene_lerp (shear_a[XY_SHEAR], shear_b[XY_SHEAR], factor);
-  if (shear != 0.f)
-    graphene_matrix_skew_xy (res, shear);
+      p = graphene_simd4x4f_init (graphene_simd4f_init (1.f, 0.f, 0.f, graphene_simd4f_get_x (perspective)),
+                                  graphene_simd4f_init (0.f, 1.f, 0.f, graphene_simd4f_get_y (perspective)),
+                                  graphene_simd4f_init (0.f, 0.f, 1.f, graphene_simd4f_get_z (perspective)),
+                                  graphene_simd4f_init (0.f, 0.f, 0.f, graphene_simd4f_get_w (perspective)));
+
+      graphene_simd4x4f_matrix_mul (&res->value, &p, &res->value);
+    }
+}
+
+/**
+ * graphene_matrix_interpolator_interpolate:
+ * @i: a #graphene_matrix_interpolator_t
+ * @factor: the linear interpolation factor
+ * @res: (out caller-allocates): return location for the
+ *   interpolated matrix
+ *
+ * Computes the matrix at the given @factor between the two matrices
+ * used to initialize @i.
+ *
+ * The result is the same as calling graphene_matrix_interpolate()
+ * with the same matrices.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_interpolator_interpolate (const graphene_matrix_interpolator_t *i,
+                                          double                                factor,
+                                          graphene_matrix_t                    *res)
+{
+  matrix_interpolator_recompose (i, factor, res);
+}
+
+/**
+ * graphene_matrix_interpolator_interpolate_array:
+ * @i: a #graphene_matrix_interpolator_t
+ * @n_factors: the number of factors
+ * @factors: (array length=n_factors): the linear interpolation factors
+ * @res: (array length=n_factors) (out caller-allocates): return location
+ *   for the interpolated matrices
+ *
+ * Computes the matrix at each of the given @factors between the two
+ * matrices used to initialize @i.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix_interpolator_interpolate_array (const graphene_matrix_interpolator_t *i,
+                                                unsigned int                          n_factors,
+                                                const float                           factors[],
+                                                graphene_matrix_t                     res[])
+{
+  unsigned int j;
+
+  for (j = 0; j < n_factors; j++)
+    matrix_interpolator_recompose (i, factors[j], &res[j]);
+}
+
+/**
+ * graphene_matrix_interpolate:
+ * @a: a #graphene_matrix_t
+ * @b: a #graphene_matrix_t
+ * @factor: the linear interpolation factor
+ * @res: (out caller-allocates): return location for the
+ *   interpolated matrix
+ *
+ * Linearly interpolates the two given #graphene_matrix_t by
+ * interpolating the decomposed transformations separately.
+ *
+ * If either matrix cannot be reduced to their transformations
+ * then the interpolation cannot be performed, and this function
+ * will return an identity matrix.
+ *
+ * If you need to interpolate the same two matrices multiple times,
+ * you should use a #graphene_matrix_interpolator_t instead.
+ *
+ * Since: 1.0
+ */
+void
+graphene_matrix_interpolate (const graphene_matrix_t *a,
+                             const graphene_matrix_t *b,
+                             double                   factor,
+                             graphene_matrix_t       *res)
+{
+  graphene_matrix_interpolator_t i;
 
-  graphene_point3d_interpolate (&scale_a, &scale_b, factor, &scale_r);
-  if (scale_r.x != 1.f && scale_r.y != 1.f && scale_r.z != 1.f)
-    graphene_matrix_scale (res, scale_r.x, scale_r.y, scale_r.z);
+  graphene_matrix_interpolator_init (&i, a, b);
+  matrix_interpolator_recompose (&i, factor, res);
 }
 
 /**
@@ -25,6 +25,8 @@
 #define __GRAPHENE_MATRIX_H__
 
 #include "graphene-types.h"
+#include "graphene-box.h"
+#include "graphene-rect.h"
 
 GRAPHENE_BEGIN_DECLS
 
@@ -42,6 +44,33 @@ struct _graphene_matrix_t
   GRAPHENE_PRIVATE_FIELD (graphene_simd4x4f_t, value);
 };
 
+/**
+ * graphene_matrix_interpolator_t:
+ *
+ * A structure holding the decomposed transformations of two
+ * #graphene_matrix_t, used to interpolate between them; see
+ * graphene_matrix_interpolator_init().
+ *
+ * The contents of the #graphene_matrix_interpolator_t structure are
+ * private and should never be accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_matrix_interpolator_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, translate[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, scale[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, shear[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, perspective[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, rotate[2]);
+  GRAPHENE_PRIVATE_FIELD (float, theta);
+  GRAPHENE_PRIVATE_FIELD (float, r_sin_theta);
+  GRAPHENE_PRIVATE_FIELD (float, cos_theta);
+  GRAPHENE_PRIVATE_FIELD (bool, is_valid);
+  GRAPHENE_PRIVATE_FIELD (bool, has_perspective);
+};
+
 GRAPHENE_AVAILABLE_IN_1_0
 graphene_matrix_t *     graphene_matrix_alloc                   (void);
 GRAPHENE_AVAILABLE_IN_1_0
@@ -117,10 +146,21 @@ GRAPHENE_AVAILABLE_IN_1_0
 bool                    graphene_matrix_is_identity             (const graphene_matrix_t  *m);
 GRAPHENE_AVAILABLE_IN_1_0
 bool                    graphene_matrix_is_2d                   (const graphene_matrix_t  *m);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_preserves_axis_alignment (const graphene_matrix_t *m);
 GRAPHENE_AVAILABLE_IN_1_0
 bool                    graphene_matrix_is_backface_visible     (const graphene_matrix_t  *m);
 GRAPHENE_AVAILABLE_IN_1_0
 bool                    graphene_matrix_is_singular             (const graphene_matrix_t  *m);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_exact_equal             (const graphene_matrix_t  *a,
+                                                                 const graphene_matrix_t  *b);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_near                    (const graphene_matrix_t  *a,
+                                                                 const graphene_matrix_t  *b,
+                                                                 float                     epsilon);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int            graphene_matrix_hash                    (const graphene_matrix_t  *m);
 
 GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_to_float                (const graphene_matrix_t  *m,
@@ -175,6 +215,11 @@ GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_transform_bounds        (const graphene_matrix_t  *m,
                                                                  const graphene_rect_t    *r,
                                                                  graphene_rect_t          *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix_transform_bounds_array  (const graphene_matrix_t  *m,
+                                                                 unsigned int              n_rects,
+                                                                 const graphene_rect_t     rects[],
+                                                                 graphene_rect_t           res[]);
 GRAPHENE_AVAILABLE_IN_1_2
 void                    graphene_matrix_transform_sphere        (const graphene_matrix_t  *m,
                                                                  const graphene_sphere_t  *s,
@@ -184,6 +229,11 @@ void                    graphene_matrix_transform_box           (const graphene_
                                                                  const graphene_box_t     *b,
                                                                  graphene_box_t           *res);
 GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix_transform_boxes         (const graphene_matrix_t  *m,
+                                                                 unsigned int              n_boxes,
+                                                                 const graphene_box_t      boxes[],
+                                                                 graphene_box_t            res[]);
+GRAPHENE_AVAILABLE_IN_1_4
 void                    graphene_matrix_transform_ray           (const graphene_matrix_t  *m,
                                                                  const graphene_ray_t     *r,
                                                                  graphene_ray_t           *res);
@@ -196,6 +246,11 @@ GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_project_rect_bounds     (const graphene_matrix_t  *m,
                                                                  const graphene_rect_t    *r,
                                                                  graphene_rect_t          *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix_project_rect_bounds_array (const graphene_matrix_t *m,
+                                                                 unsigned int              n_rects,
+                                                                 const graphene_rect_t     rects[],
+                                                                 graphene_rect_t           res[]);
 GRAPHENE_AVAILABLE_IN_1_2
 void                    graphene_matrix_project_rect            (const graphene_matrix_t  *m,
                                                                  const graphene_rect_t    *r,
@@ -210,6 +265,12 @@ void                    graphene_matrix_untransform_bounds      (const graphene_
                                                                  const graphene_rect_t    *r,
                                                                  const graphene_rect_t    *bounds,
                                                                  graphene_rect_t          *res);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_clip_rect               (const graphene_matrix_t  *m,
+                                                                 const graphene_rect_t    *r,
+                                                                 const graphene_rect_t    *clip,
+                                                                 graphene_rect_t          *res,
+                                                                 graphene_quad_t          *res_quad);
 GRAPHENE_AVAILABLE_IN_1_2
 void                    graphene_matrix_unproject_point3d       (const graphene_matrix_t  *projection,
                                                                  const graphene_matrix_t  *modelview,
@@ -259,6 +320,19 @@ void                    graphene_matrix_transpose               (const graphene_
 GRAPHENE_AVAILABLE_IN_1_0
 bool                    graphene_matrix_inverse                 (const graphene_matrix_t  *m,
                                                                  graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_inverse_affine          (const graphene_matrix_t  *m,
+                                                                 graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_inverse_rigid           (const graphene_matrix_t  *m,
+                                                                 graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_get_normal_matrix       (const graphene_matrix_t  *m,
+                                                                 graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int            graphene_matrix_get_normal_matrix_array (unsigned int              n_matrices,
+                                                                 const graphene_matrix_t   m[],
+                                                                 graphene_matrix_t         res[]);
 GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_perspective             (const graphene_matrix_t  *m,
                                                                  float                     depth,
@@ -274,12 +348,39 @@ float                   graphene_matrix_get_y_scale             (const graphene_
 GRAPHENE_AVAILABLE_IN_1_0
 float                   graphene_matrix_get_z_scale             (const graphene_matrix_t  *m);
 
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix_decompose               (const graphene_matrix_t *m,
+                                                                 graphene_vec3_t         *translate,
+                                                                 graphene_vec3_t         *scale,
+                                                                 graphene_quaternion_t   *rotate,
+                                                                 graphene_vec3_t         *shear,
+                                                                 graphene_vec4_t         *perspective);
 GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_interpolate             (const graphene_matrix_t  *a,
                                                                  const graphene_matrix_t  *b,
                                                                  double                    factor,
                                                                  graphene_matrix_t        *res);
 
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix_interpolator_t * graphene_matrix_interpolator_alloc             (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                             graphene_matrix_interpolator_free              (graphene_matrix_interpolator_t *i);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix_interpolator_t * graphene_matrix_interpolator_init              (graphene_matrix_interpolator_t *i,
+                                                                                 const graphene_matrix_t        *a,
+                                                                                 const graphene_matrix_t        *b);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                             graphene_matrix_interpolator_is_valid          (const graphene_matrix_interpolator_t *i);
+GRAPHENE_AVAILABLE_IN_1_4
+void                             graphene_matrix_interpolator_interpolate       (const graphene_matrix_interpolator_t *i,
+                                                                                 double                                factor,
+                                                                                 graphene_matrix_t                    *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                             graphene_matrix_interpolator_interpolate_array (const graphene_matrix_interpolator_t *i,
+                                                                                 unsigned int                          n_factors,
+                                                                                 const float                           factors[],
+                                                                                 graphene_matrix_t                     res[]);
+
 GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_print                   (const graphene_matrix_t  *m);
 
@@ -0,0 +1,410 @@
+/* graphene-matrix3x4.c: Affine 3x4 matrix
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-matrix3x4
+ * @Title: Matrix3x4
+ * @Short_Description: Compact affine transformations
+ *
+ * #graphene_matrix3x4_t holds an affine transformation, that is a
+ * #graphene_matrix_t whose last column is (0, 0, 0, 1), in 48 bytes
+ * instead of 64; it is meant for large arrays of transformations,
+ * like the transformations of the instances of a mesh, where the
+ * memory bandwidth matters more than the cost of the operations.
+ *
+ * The transformations are applied like the ones of #graphene_matrix_t,
+ * and converting an affine #graphene_matrix_t to a #graphene_matrix3x4_t
+ * and back is lossless.
+ *
+ * Internally, the matrix is stored transposed, using three rows of
+ * four values, the same layout as %GRAPHENE_BUFFER_LAYOUT_3X4.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-matrix3x4.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-matrix-private.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+static inline void
+matrix3x4_to_simd4x4f (const graphene_matrix3x4_t *m,
+                       graphene_simd4x4f_t        *res)
+{
+  *res = graphene_simd4x4f_init (m->x, m->y, m->z, graphene_simd4f_init (0.f, 0.f, 0.f, 1.f));
+  graphene_simd4x4f_transpose_in_place (res);
+}
+
+static inline void
+matrix3x4_init_from_simd4x4f (graphene_matrix3x4_t      *m,
+                              const graphene_simd4x4f_t *s)
+{
+  graphene_simd4x4f_t t = *s;
+
+  graphene_simd4x4f_transpose_in_place (&t);
+
+  m->x = t.x;
+  m->y = t.y;
+  m->z = t.z;
+}
+
+/**
+ * graphene_matrix3x4_alloc: (constructor)
+ *
+ * Allocates a new #graphene_matrix3x4_t.
+ *
+ * Returns: (transfer full): the newly allocated matrix
+ *
+ * Since: 1.4
+ */
+graphene_matrix3x4_t *
+graphene_matrix3x4_alloc (void)
+{
+  return graphene_aligned_alloc0 (sizeof (graphene_matrix3x4_t), 1, 16);
+}
+
+/**
+ * graphene_matrix3x4_free:
+ * @m: a #graphene_matrix3x4_t
+ *
+ * Frees the resources allocated by graphene_matrix3x4_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_free (graphene_matrix3x4_t *m)
+{
+  graphene_aligned_free (m);
+}
+
+/**
+ * graphene_matrix3x4_init_identity:
+ * @m: a #graphene_matrix3x4_t
+ *
+ * Initializes a #graphene_matrix3x4_t with the identity matrix.
+ *
+ * Returns: (transfer none): the initialized matrix
+ *
+ * Since: 1.4
+ */
+graphene_matrix3x4_t *
+graphene_matrix3x4_init_identity (graphene_matrix3x4_t *m)
+{
+  m->x = graphene_simd4f_init (1.f, 0.f, 0.f, 0.f);
+  m->y = graphene_simd4f_init (0.f, 1.f, 0.f, 0.f);
+  m->z = graphene_simd4f_init (0.f, 0.f, 1.f, 0.f);
+
+  return m;
+}
+
+/**
+ * graphene_matrix3x4_init_from_float:
+ * @m: a #graphene_matrix3x4_t
+ * @v: (array fixed-size=12): an array of at least 12 floating
+ *   point values, in the %GRAPHENE_BUFFER_LAYOUT_3X4 layout
+ *
+ * Initializes a #graphene_matrix3x4_t with the given array of
+ * floating point values; the first three columns of the matrix are
+ * read as rows, and each row ends with the translation on one axis.
+ *
+ * Returns: (transfer none): the initialized matrix
+ *
+ * Since: 1.4
+ */
+graphene_matrix3x4_t *
+graphene_matrix3x4_init_from_float (graphene_matrix3x4_t *m,
+                                    const float          *v)
+{
+  m->x = graphene_simd4f_init_4f (v + 0);
+  m->y = graphene_simd4f_init_4f (v + 4);
+  m->z = graphene_simd4f_init_4f (v + 8);
+
+  return m;
+}
+
+/**
+ * graphene_matrix3x4_init_from_matrix:
+ * @m: a #graphene_matrix3x4_t
+ * @src: an affine #graphene_matrix_t
+ *
+ * Initializes a #graphene_matrix3x4_t with the transformation of
+ * the given #graphene_matrix_t.
+ *
+ * The last column of @src, which is (0, 0, 0, 1) for an affine
+ * transformation, is not stored; the conversion of an affine
+ * matrix is lossless.
+ *
+ * Returns: (transfer none): the initialized matrix
+ *
+ * Since: 1.4
+ */
+graphene_matrix3x4_t *
+graphene_matrix3x4_init_from_matrix (graphene_matrix3x4_t    *m,
+                                     const graphene_matrix_t *src)
+{
+  matrix3x4_init_from_simd4x4f (m, &src->value);
+
+  return m;
+}
+
+/**
+ * graphene_matrix3x4_to_float:
+ * @m: a #graphene_matrix3x4_t
+ * @v: (array fixed-size=12) (out caller-allocates): return location
+ *   for an array of at least 12 floating point values
+ *
+ * Stores the values of @m in the %GRAPHENE_BUFFER_LAYOUT_3X4 layout;
+ * see graphene_matrix3x4_init_from_float().
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_to_float (const graphene_matrix3x4_t *m,
+                             float                      *v)
+{
+  graphene_simd4f_dup_4f (m->x, v + 0);
+  graphene_simd4f_dup_4f (m->y, v + 4);
+  graphene_simd4f_dup_4f (m->z, v + 8);
+}
+
+/**
+ * graphene_matrix3x4_to_matrix:
+ * @m: a #graphene_matrix3x4_t
+ * @res: (out caller-allocates): return location for the matrix
+ *
+ * Converts a #graphene_matrix3x4_t to a #graphene_matrix_t, whose
+ * last column is set to (0, 0, 0, 1).
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_to_matrix (const graphene_matrix3x4_t *m,
+                              graphene_matrix_t          *res)
+{
+  matrix3x4_to_simd4x4f (m, &res->value);
+}
+
+/**
+ * graphene_matrix3x4_multiply:
+ * @a: a #graphene_matrix3x4_t
+ * @b: a #graphene_matrix3x4_t
+ * @res: (out caller-allocates): return location for the result
+ *
+ * Multiplies two #graphene_matrix3x4_t; like graphene_matrix_multiply(),
+ * the transformation in @a is applied before the one in @b.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_multiply (const graphene_matrix3x4_t *a,
+                             const graphene_matrix3x4_t *b,
+                             graphene_matrix3x4_t       *res)
+{
+  const graphene_simd4f_t w_mask = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  const graphene_simd4f_t rows[3] = { b->x, b->y, b->z };
+  const graphene_simd4f_t a_x = a->x, a_y = a->y, a_z = a->z;
+  graphene_simd4f_t res_rows[3];
+  unsigned int i;
+
+  /* the rows are stored transposed, so each row of the result is
+   * a combination of the rows of @a, plus the translation of @b
+   */
+  for (i = 0; i < 3; i++)
+    {
+      res_rows[i] = graphene_simd4f_madd (graphene_simd4f_splat_x (rows[i]), a_x,
+                                          graphene_simd4f_madd (graphene_simd4f_splat_y (rows[i]), a_y,
+                                                                graphene_simd4f_madd (graphene_simd4f_splat_z (rows[i]), a_z,
+                                                                                      graphene_simd4f_mul (rows[i], w_mask))));
+    }
+
+  res->x = res_rows[0];
+  res->y = res_rows[1];
+  res->z = res_rows[2];
+}
+
+/**
+ * graphene_matrix3x4_inverse:
+ * @m: a #graphene_matrix3x4_t
+ * @res: (out caller-allocates): return location for the inverse matrix
+ *
+ * Inverts the given affine transformation, like graphene_matrix_inverse().
+ *
+ * Returns: `true` if the matrix is invertible
+ *
+ * Since: 1.4
+ */
+bool
+graphene_matrix3x4_inverse (const graphene_matrix3x4_t *m,
+                            graphene_matrix3x4_t       *res)
+{
+  graphene_matrix_t tmp;
+
+  graphene_matrix3x4_to_matrix (m, &tmp);
+
+  if (!graphene_matrix_inverse (&tmp, &tmp))
+    return false;
+
+  graphene_matrix3x4_init_from_matrix (res, &tmp);
+
+  return true;
+}
+
+/**
+ * graphene_matrix3x4_transform_vec3:
+ * @m: a #graphene_matrix3x4_t
+ * @v: a #graphene_vec3_t
+ * @res: (out caller-allocates): return location for the transformed vector
+ *
+ * Transforms the given #graphene_vec3_t using the matrix @m, without
+ * the translation; see graphene_matrix_transform_vec3().
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_transform_vec3 (const graphene_matrix3x4_t *m,
+                                   const graphene_vec3_t      *v,
+                                   graphene_vec3_t            *res)
+{
+  res->value = graphene_matrix3x4_transform_internal (m->x, m->y, m->z,
+                                                      graphene_simd4f_zero_w (v->value));
+}
+
+/**
+ * graphene_matrix3x4_transform_point3d:
+ * @m: a #graphene_matrix3x4_t
+ * @p: a #graphene_point3d_t
+ * @res: (out caller-allocates): return location for the transformed point
+ *
+ * Transforms the given #graphene_point3d_t using the matrix @m; see
+ * graphene_matrix_transform_point3d().
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_transform_point3d (const graphene_matrix3x4_t *m,
+                                      const graphene_point3d_t   *p,
+                                      graphene_point3d_t         *res)
+{
+  graphene_simd4f_t v;
+  float values[4];
+
+  v = graphene_simd4f_init (p->x, p->y, p->z, 1.f);
+  v = graphene_matrix3x4_transform_internal (m->x, m->y, m->z, v);
+
+  graphene_simd4f_dup_4f (v, values);
+  graphene_point3d_init (res, values[0], values[1], values[2]);
+}
+
+/**
+ * graphene_matrix3x4_transform_points:
+ * @m: a #graphene_matrix3x4_t
+ * @n_points: the number of points to transform
+ * @points: (array length=n_points): the points to transform
+ * @res: (out caller-allocates) (array length=n_points): return location
+ *   for the transformed points
+ *
+ * Transforms an array of #graphene_point3d_t using the matrix @m.
+ *
+ * The points are processed in groups of four, with each component of
+ * the four points held in a vector.
+ *
+ * The @points and @res arrays can be the same.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_transform_points (const graphene_matrix3x4_t *m,
+                                     unsigned int                n_points,
+                                     const graphene_point3d_t    points[],
+                                     graphene_point3d_t          res[])
+{
+  const graphene_simd4f_t rows[3] = { m->x, m->y, m->z };
+  graphene_simd4f_t c[3][4];
+  unsigned int i, j;
+
+  /* c[j][k] contains the coefficient of the k-th input component, or
+   * the translation, for the j-th output component in all four lanes
+   */
+  for (j = 0; j < 3; j++)
+    {
+      c[j][0] = graphene_simd4f_splat_x (rows[j]);
+      c[j][1] = graphene_simd4f_splat_y (rows[j]);
+      c[j][2] = graphene_simd4f_splat_z (rows[j]);
+      c[j][3] = graphene_simd4f_splat_w (rows[j]);
+    }
+
+  for (i = 0; i + 4 <= n_points; i += 4)
+    {
+      const graphene_point3d_t *p = points + i;
+      graphene_simd4f_t x, y, z, v;
+      float values[3][4];
+
+      x = graphene_simd4f_init (p[0].x, p[1].x, p[2].x, p[3].x);
+      y = graphene_simd4f_init (p[0].y, p[1].y, p[2].y, p[3].y);
+      z = graphene_simd4f_init (p[0].z, p[1].z, p[2].z, p[3].z);
+
+      for (j = 0; j < 3; j++)
+        {
+          v = graphene_simd4f_madd (x, c[j][0], c[j][3]);
+          v = graphene_simd4f_madd (y, c[j][1], v);
+          v = graphene_simd4f_madd (z, c[j][2], v);
+
+          graphene_simd4f_dup_4f (v, values[j]);
+        }
+
+      for (j = 0; j < 4; j++)
+        graphene_point3d_init (&res[i + j], values[0][j], values[1][j], values[2][j]);
+    }
+
+  for (; i < n_points; i++)
+    graphene_matrix3x4_transform_point3d (m, &points[i], &res[i]);
+}
+
+/**
+ * graphene_matrix3x4_transform_boxes:
+ * @m: a #graphene_matrix3x4_t
+ * @n_boxes: the number of boxes to transform
+ * @boxes: (array length=n_boxes): the boxes to transform
+ * @res: (out caller-allocates) (array length=n_boxes): return location
+ *   for the bounds of the transformed boxes
+ *
+ * Transforms an array of #graphene_box_t using the matrix @m; see
+ * graphene_matrix_transform_boxes().
+ *
+ * The @boxes and @res arrays can be the same.
+ *
+ * Since: 1.4
+ */
+void
+graphene_matrix3x4_transform_boxes (const graphene_matrix3x4_t *m,
+                                    unsigned int                n_boxes,
+                                    const graphene_box_t        boxes[],
+                                    graphene_box_t              res[])
+{
+  graphene_matrix_t tmp;
+
+  graphene_matrix3x4_to_matrix (m, &tmp);
+  graphene_matrix_transform_boxes (&tmp, n_boxes, boxes, res);
+}
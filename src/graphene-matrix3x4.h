@@ -0,0 +1,107 @@
+/* graphene-matrix3x4.h: Affine 3x4 matrix
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_MATRIX3X4_H__
+#define __GRAPHENE_MATRIX3X4_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-box.h"
+#include "graphene-matrix.h"
+#include "graphene-point3d.h"
+#include "graphene-vec3.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_matrix3x4_t:
+ *
+ * A structure capable of holding an affine transformation, using
+ * three quarters of the storage of a #graphene_matrix_t.
+ *
+ * The contents of the #graphene_matrix3x4_t structure are private and
+ * should never be accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_matrix3x4_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, x);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, y);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, z);
+};
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix3x4_t *  graphene_matrix3x4_alloc                (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_free                 (graphene_matrix3x4_t       *m);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix3x4_t *  graphene_matrix3x4_init_identity        (graphene_matrix3x4_t       *m);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix3x4_t *  graphene_matrix3x4_init_from_float      (graphene_matrix3x4_t       *m,
+                                                                 const float                *v);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_matrix3x4_t *  graphene_matrix3x4_init_from_matrix     (graphene_matrix3x4_t       *m,
+                                                                 const graphene_matrix_t    *src);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_to_float             (const graphene_matrix3x4_t *m,
+                                                                 float                      *v);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_to_matrix            (const graphene_matrix3x4_t *m,
+                                                                 graphene_matrix_t          *res);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_multiply             (const graphene_matrix3x4_t *a,
+                                                                 const graphene_matrix3x4_t *b,
+                                                                 graphene_matrix3x4_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_matrix3x4_inverse              (const graphene_matrix3x4_t *m,
+                                                                 graphene_matrix3x4_t       *res);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_transform_vec3       (const graphene_matrix3x4_t *m,
+                                                                 const graphene_vec3_t      *v,
+                                                                 graphene_vec3_t            *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_transform_point3d    (const graphene_matrix3x4_t *m,
+                                                                 const graphene_point3d_t   *p,
+                                                                 graphene_point3d_t         *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_transform_points     (const graphene_matrix3x4_t *m,
+                                                                 unsigned int                n_points,
+                                                                 const graphene_point3d_t    points[],
+                                                                 graphene_point3d_t          res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_matrix3x4_transform_boxes      (const graphene_matrix3x4_t *m,
+                                                                 unsigned int                n_boxes,
+                                                                 const graphene_box_t        boxes[],
+                                                                 graphene_box_t              res[]);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_MATRIX3X4_H__ */
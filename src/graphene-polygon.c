@@ -0,0 +1,572 @@
+/* graphene-polygon.c: Convex polygon
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-polygon
+ * @Title: Polygon
+ * @Short_Description: A convex polygon with a bounded number of vertices
+ *
+ * #graphene_polygon_t represents a convex polygon with up to
+ * %GRAPHENE_POLYGON_MAX_VERTICES vertices, like the intersection of
+ * a #graphene_quad_t with a #graphene_rect_t.
+ *
+ * The coordinates of the vertices are stored as separate arrays of
+ * X and Y components, so that they can be processed four at a time.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-polygon.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-simd4f.h"
+
+#include <math.h>
+#include <string.h>
+
+/* the vertex buffer used when clipping; each clipping plane can at most
+ * double the number of vertices of a non-convex polygon
+ */
+#define CLIP_BUFFER_SIZE        (GRAPHENE_POLYGON_MAX_VERTICES * 3)
+
+/**
+ * graphene_polygon_alloc: (constructor)
+ *
+ * Allocates a new #graphene_polygon_t.
+ *
+ * The contents of the returned structure are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_polygon_t.
+ *   Use graphene_polygon_free() to free the resources allocated by
+ *   this function
+ *
+ * Since: 1.4
+ */
+graphene_polygon_t *
+graphene_polygon_alloc (void)
+{
+  return graphene_aligned_alloc0 (sizeof (graphene_polygon_t), 1, 16);
+}
+
+/**
+ * graphene_polygon_free:
+ * @p: a #graphene_polygon_t
+ *
+ * Frees the resources allocated by graphene_polygon_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_polygon_free (graphene_polygon_t *p)
+{
+  graphene_aligned_free (p);
+}
+
+/*< private >
+ * graphene_polygon_set_vertices:
+ * @p: a #graphene_polygon_t
+ * @n_vertices: the number of vertices, at most %GRAPHENE_POLYGON_MAX_VERTICES
+ * @x: the X coordinates of the vertices
+ * @y: the Y coordinates of the vertices
+ *
+ * Stores the vertices of the polygon. The unused lanes are filled with
+ * copies of the first vertex, so that they can be treated as degenerate
+ * edges, and do not affect the bounds.
+ */
+static void
+graphene_polygon_set_vertices (graphene_polygon_t *p,
+                               unsigned int        n_vertices,
+                               const float        *x,
+                               const float        *y)
+{
+  float xs[GRAPHENE_POLYGON_MAX_VERTICES] = { 0.f, };
+  float ys[GRAPHENE_POLYGON_MAX_VERTICES] = { 0.f, };
+  unsigned int i;
+
+  for (i = 0; i < GRAPHENE_POLYGON_MAX_VERTICES; i++)
+    {
+      if (i < n_vertices)
+        {
+          xs[i] = x[i];
+          ys[i] = y[i];
+        }
+      else if (n_vertices > 0)
+        {
+          xs[i] = x[0];
+          ys[i] = y[0];
+        }
+    }
+
+  p->xs[0] = graphene_simd4f_init_4f (xs);
+  p->xs[1] = graphene_simd4f_init_4f (xs + 4);
+  p->ys[0] = graphene_simd4f_init_4f (ys);
+  p->ys[1] = graphene_simd4f_init_4f (ys + 4);
+  p->n_vertices = n_vertices;
+}
+
+/**
+ * graphene_polygon_init:
+ * @p: the #graphene_polygon_t to initialize
+ * @n_points: the number of points in @points
+ * @points: (array length=n_points): the vertices of the polygon
+ *
+ * Initializes a #graphene_polygon_t using an array of points, which
+ * should describe a convex polygon.
+ *
+ * If @n_points is bigger than %GRAPHENE_POLYGON_MAX_VERTICES, only
+ * the first %GRAPHENE_POLYGON_MAX_VERTICES points are used.
+ *
+ * Returns: (transfer none): the initialized #graphene_polygon_t
+ *
+ * Since: 1.4
+ */
+graphene_polygon_t *
+graphene_polygon_init (graphene_polygon_t     *p,
+                       unsigned int            n_points,
+                       const graphene_point_t  points[])
+{
+  float x[GRAPHENE_POLYGON_MAX_VERTICES], y[GRAPHENE_POLYGON_MAX_VERTICES];
+  unsigned int i;
+
+  n_points = MIN (n_points, GRAPHENE_POLYGON_MAX_VERTICES);
+
+  for (i = 0; i < n_points; i++)
+    {
+      x[i] = points[i].x;
+      y[i] = points[i].y;
+    }
+
+  graphene_polygon_set_vertices (p, n_points, x, y);
+
+  return p;
+}
+
+/**
+ * graphene_polygon_init_from_quad:
+ * @p: the #graphene_polygon_t to initialize
+ * @q: a #graphene_quad_t
+ *
+ * Initializes a #graphene_polygon_t using the four vertices of
+ * the given #graphene_quad_t, in the same order.
+ *
+ * Returns: (transfer none): the initialized #graphene_polygon_t
+ *
+ * Since: 1.4
+ */
+graphene_polygon_t *
+graphene_polygon_init_from_quad (graphene_polygon_t    *p,
+                                 const graphene_quad_t *q)
+{
+  graphene_point_t points[4];
+  unsigned int i;
+
+  for (i = 0; i < 4; i++)
+    points[i] = *graphene_quad_get_point (q, i);
+
+  return graphene_polygon_init (p, 4, points);
+}
+
+/**
+ * graphene_polygon_init_from_rect:
+ * @p: the #graphene_polygon_t to initialize
+ * @r: a #graphene_rect_t
+ *
+ * Initializes a #graphene_polygon_t using the four corners of
+ * the given #graphene_rect_t, starting from the top left corner,
+ * in clockwise order.
+ *
+ * Returns: (transfer none): the initialized #graphene_polygon_t
+ *
+ * Since: 1.4
+ */
+graphene_polygon_t *
+graphene_polygon_init_from_rect (graphene_polygon_t    *p,
+                                 const graphene_rect_t *r)
+{
+  graphene_point_t points[4];
+
+  graphene_rect_get_top_left (r, &points[0]);
+  graphene_rect_get_top_right (r, &points[1]);
+  graphene_rect_get_bottom_right (r, &points[2]);
+  graphene_rect_get_bottom_left (r, &points[3]);
+
+  return graphene_polygon_init (p, 4, points);
+}
+
+/**
+ * graphene_polygon_get_n_vertices:
+ * @p: a #graphene_polygon_t
+ *
+ * Retrieves the number of vertices of a #graphene_polygon_t.
+ *
+ * Returns: the number of vertices
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_polygon_get_n_vertices (const graphene_polygon_t *p)
+{
+  return p->n_vertices;
+}
+
+/**
+ * graphene_polygon_get_vertex:
+ * @p: a #graphene_polygon_t
+ * @index_: the index of the vertex, between 0 and the number
+ *   of vertices of the polygon
+ * @res: (out caller-allocates): return location for the vertex
+ *
+ * Retrieves the vertex of a #graphene_polygon_t at the given index.
+ *
+ * Since: 1.4
+ */
+void
+graphene_polygon_get_vertex (const graphene_polygon_t *p,
+                             unsigned int              index_,
+                             graphene_point_t         *res)
+{
+  float x[GRAPHENE_POLYGON_MAX_VERTICES], y[GRAPHENE_POLYGON_MAX_VERTICES];
+
+  graphene_simd4f_dup_4f (p->xs[0], x);
+  graphene_simd4f_dup_4f (p->xs[1], x + 4);
+  graphene_simd4f_dup_4f (p->ys[0], y);
+  graphene_simd4f_dup_4f (p->ys[1], y + 4);
+
+  index_ = MIN (index_, GRAPHENE_POLYGON_MAX_VERTICES - 1);
+
+  graphene_point_init (res, x[index_], y[index_]);
+}
+
+/*< private >
+ * graphene_polygon_get_next_vertices:
+ * @p: a #graphene_polygon_t
+ * @xs: (out) (array fixed-size=2): the X coordinates of the next vertices
+ * @ys: (out) (array fixed-size=2): the Y coordinates of the next vertices
+ *
+ * Rotates the vertices by one lane, so that each lane of the result
+ * contains the end point of the edge starting at the same lane.
+ */
+static inline void
+graphene_polygon_get_next_vertices (const graphene_polygon_t *p,
+                                    graphene_simd4f_t         xs[2],
+                                    graphene_simd4f_t         ys[2])
+{
+  float x[GRAPHENE_POLYGON_MAX_VERTICES + 1], y[GRAPHENE_POLYGON_MAX_VERTICES + 1];
+
+  graphene_simd4f_dup_4f (p->xs[0], x);
+  graphene_simd4f_dup_4f (p->xs[1], x + 4);
+  graphene_simd4f_dup_4f (p->ys[0], y);
+  graphene_simd4f_dup_4f (p->ys[1], y + 4);
+
+  x[GRAPHENE_POLYGON_MAX_VERTICES] = x[0];
+  y[GRAPHENE_POLYGON_MAX_VERTICES] = y[0];
+
+  xs[0] = graphene_simd4f_init_4f (x + 1);
+  xs[1] = graphene_simd4f_init_4f (x + 5);
+  ys[0] = graphene_simd4f_init_4f (y + 1);
+  ys[1] = graphene_simd4f_init_4f (y + 5);
+}
+
+/*< private >
+ * graphene_polygon_get_signed_area:
+ * @p: a #graphene_polygon_t
+ *
+ * Computes twice the signed area of the polygon, using the shoelace
+ * formula; the padding lanes are degenerate edges, and do not contribute
+ * to the sum.
+ */
+static inline float
+graphene_polygon_get_signed_area (const graphene_polygon_t *p,
+                                  const graphene_simd4f_t   next_x[2],
+                                  const graphene_simd4f_t   next_y[2])
+{
+  graphene_simd4f_t a, b;
+
+  a = graphene_simd4f_sub (graphene_simd4f_mul (p->xs[0], next_y[0]),
+                           graphene_simd4f_mul (next_x[0], p->ys[0]));
+  b = graphene_simd4f_sub (graphene_simd4f_mul (p->xs[1], next_y[1]),
+                           graphene_simd4f_mul (next_x[1], p->ys[1]));
+
+  return graphene_simd4f_sum_scalar (graphene_simd4f_add (a, b));
+}
+
+/**
+ * graphene_polygon_contains_point:
+ * @p: a #graphene_polygon_t
+ * @point: a #graphene_point_t
+ *
+ * Checks whether the given @point is inside the polygon, or on one
+ * of its edges.
+ *
+ * The point is tested against all the edges of the polygon at once.
+ *
+ * Returns: `true` if the polygon contains the point; polygons with
+ *   no area do not contain any point
+ *
+ * Since: 1.4
+ */
+bool
+graphene_polygon_contains_point (const graphene_polygon_t *p,
+                                 const graphene_point_t   *point)
+{
+  graphene_simd4f_t next_x[2], next_y[2];
+  graphene_simd4f_t px, py, sign, d[2];
+  float area;
+  int i;
+
+  if (p->n_vertices < 3)
+    return false;
+
+  graphene_polygon_get_next_vertices (p, next_x, next_y);
+
+  /* the area is only used for its sign, which gives the winding of
+   * the polygon; any tolerance here would depend on the scale of the
+   * coordinates, so only polygons with exactly no area are rejected
+   */
+  area = graphene_polygon_get_signed_area (p, next_x, next_y);
+  if (area == 0.f)
+    return false;
+
+  px = graphene_simd4f_splat (point->x);
+  py = graphene_simd4f_splat (point->y);
+  sign = graphene_simd4f_splat (area > 0.f ? 1.f : -1.f);
+
+  /* the cross product between each edge and the vector from the start
+   * of the edge to the point; for a counter-clockwise polygon, the point
+   * is inside if it is on the left side of all edges
+   */
+  for (i = 0; i < 2; i++)
+    {
+      const graphene_simd4f_t e_x = graphene_simd4f_sub (next_x[i], p->xs[i]);
+      const graphene_simd4f_t e_y = graphene_simd4f_sub (next_y[i], p->ys[i]);
+
+      d[i] = graphene_simd4f_sub (graphene_simd4f_mul (e_x, graphene_simd4f_sub (py, p->ys[i])),
+                                  graphene_simd4f_mul (e_y, graphene_simd4f_sub (px, p->xs[i])));
+      d[i] = graphene_simd4f_mul (d[i], sign);
+    }
+
+  return graphene_simd4f_get_x (graphene_simd4f_min_val (graphene_simd4f_min (d[0], d[1]))) >= 0.f;
+}
+
+/**
+ * graphene_polygon_get_area:
+ * @p: a #graphene_polygon_t
+ *
+ * Computes the area of the given #graphene_polygon_t.
+ *
+ * Returns: the area of the polygon
+ *
+ * Since: 1.4
+ */
+float
+graphene_polygon_get_area (const graphene_polygon_t *p)
+{
+  graphene_simd4f_t next_x[2], next_y[2];
+
+  if (p->n_vertices < 3)
+    return 0.f;
+
+  graphene_polygon_get_next_vertices (p, next_x, next_y);
+
+  return fabsf (graphene_polygon_get_signed_area (p, next_x, next_y)) * 0.5f;
+}
+
+/**
+ * graphene_polygon_get_bounds:
+ * @p: a #graphene_polygon_t
+ * @r: (out caller-allocates): return location for the bounds
+ *
+ * Computes the bounding rectangle of the given #graphene_polygon_t.
+ *
+ * Since: 1.4
+ */
+void
+graphene_polygon_get_bounds (const graphene_polygon_t *p,
+                             graphene_rect_t          *r)
+{
+  float min_x, min_y, max_x, max_y;
+
+  if (p->n_vertices == 0)
+    {
+      graphene_rect_init (r, 0.f, 0.f, 0.f, 0.f);
+      return;
+    }
+
+  min_x = graphene_simd4f_get_x (graphene_simd4f_min_val (graphene_simd4f_min (p->xs[0], p->xs[1])));
+  min_y = graphene_simd4f_get_x (graphene_simd4f_min_val (graphene_simd4f_min (p->ys[0], p->ys[1])));
+  max_x = graphene_simd4f_get_x (graphene_simd4f_max_val (graphene_simd4f_max (p->xs[0], p->xs[1])));
+  max_y = graphene_simd4f_get_x (graphene_simd4f_max_val (graphene_simd4f_max (p->ys[0], p->ys[1])));
+
+  graphene_rect_init (r, min_x, min_y, max_x - min_x, max_y - min_y);
+}
+
+/*< private >
+ * clip_to_plane:
+ * @n_vertices: the number of vertices in @x and @y
+ * @x: the X coordinates of the input vertices
+ * @y: the Y coordinates of the input vertices
+ * @d: the signed distance of each vertex from the clipping plane
+ * @out_x: (out): the X coordinates of the clipped vertices
+ * @out_y: (out): the Y coordinates of the clipped vertices
+ *
+ * A single Sutherland-Hodgman clipping step, which keeps the part
+ * of the polygon with non-negative distance from the plane.
+ *
+ * Returns: the number of clipped vertices
+ */
+static unsigned int
+clip_to_plane (unsigned int  n_vertices,
+               const float  *x,
+               const float  *y,
+               const float  *d,
+               float        *out_x,
+               float        *out_y)
+{
+  unsigned int i, prev, n_out = 0;
+
+  for (i = 0; i < n_vertices; i++)
+    {
+      prev = i == 0 ? n_vertices - 1 : i - 1;
+
+      /* add the intersection with the plane, unless it coincides
+       * with one of the two vertices of the edge
+       */
+      if ((d[prev] < 0.f && d[i] > 0.f) || (d[prev] > 0.f && d[i] < 0.f))
+        {
+          float t = d[prev] / (d[prev] - d[i]);
+
+          out_x[n_out] = x[prev] + (x[i] - x[prev]) * t;
+          out_y[n_out] = y[prev] + (y[i] - y[prev]) * t;
+          n_out += 1;
+        }
+
+      if (d[i] >= 0.f)
+        {
+          out_x[n_out] = x[i];
+          out_y[n_out] = y[i];
+          n_out += 1;
+        }
+    }
+
+  return n_out;
+}
+
+/**
+ * graphene_polygon_intersect_rect:
+ * @p: a #graphene_polygon_t
+ * @r: a #graphene_rect_t
+ * @res: (out caller-allocates): return location for the intersection
+ *
+ * Clips the given #graphene_polygon_t against the rectangle @r, using
+ * the Sutherland-Hodgman algorithm.
+ *
+ * The intersection of a polygon with up to four vertices, like one
+ * created from a #graphene_quad_t, always fits in a #graphene_polygon_t.
+ * If the exact intersection has more than %GRAPHENE_POLYGON_MAX_VERTICES
+ * vertices, @res is set to the intersection of @r with the bounds of @p,
+ * which contains the exact intersection.
+ *
+ * Returns: `true` if the intersection is not empty
+ *
+ * Since: 1.4
+ */
+bool
+graphene_polygon_intersect_rect (const graphene_polygon_t *p,
+                                 const graphene_rect_t    *r,
+                                 graphene_polygon_t       *res)
+{
+  float x[2][CLIP_BUFFER_SIZE], y[2][CLIP_BUFFER_SIZE], d[CLIP_BUFFER_SIZE];
+  float plane_offset[4], plane_sign[4];
+  graphene_rect_t rr, bounds;
+  unsigned int i, n, plane, cur = 0;
+  bool overflow = false;
+
+  graphene_rect_normalize_r (r, &rr);
+
+  /* the planes are: x >= min_x, y >= min_y, x <= max_x, y <= max_y */
+  plane_offset[0] = rr.origin.x;
+  plane_offset[1] = rr.origin.y;
+  plane_offset[2] = rr.origin.x + rr.size.width;
+  plane_offset[3] = rr.origin.y + rr.size.height;
+  plane_sign[0] = plane_sign[1] = 1.f;
+  plane_sign[2] = plane_sign[3] = -1.f;
+
+  memset (x, 0, sizeof (x));
+  memset (y, 0, sizeof (y));
+
+  n = p->n_vertices;
+
+  graphene_simd4f_dup_4f (p->xs[0], x[0]);
+  graphene_simd4f_dup_4f (p->xs[1], x[0] + 4);
+  graphene_simd4f_dup_4f (p->ys[0], y[0]);
+  graphene_simd4f_dup_4f (p->ys[1], y[0] + 4);
+
+  for (plane = 0; plane < 4 && n > 0; plane++)
+    {
+      const float *c = (plane % 2) == 0 ? x[cur] : y[cur];
+      const graphene_simd4f_t offset = graphene_simd4f_splat (plane_offset[plane]);
+      const graphene_simd4f_t sign = graphene_simd4f_splat (plane_sign[plane]);
+
+      /* each clipping step can at most double the vertices */
+      if (n > CLIP_BUFFER_SIZE / 2)
+        {
+          overflow = true;
+          break;
+        }
+
+      /* the signed distances from the plane, four vertices at a time */
+      for (i = 0; i < n; i += 4)
+        {
+          graphene_simd4f_t v = graphene_simd4f_init_4f (c + i);
+
+          v = graphene_simd4f_mul (graphene_simd4f_sub (v, offset), sign);
+          graphene_simd4f_dup_4f (v, d + i);
+        }
+
+      n = clip_to_plane (n, x[cur], y[cur], d, x[1 - cur], y[1 - cur]);
+      cur = 1 - cur;
+    }
+
+  if (overflow || n > GRAPHENE_POLYGON_MAX_VERTICES)
+    {
+      graphene_polygon_get_bounds (p, &bounds);
+      if (!graphene_rect_intersection (&bounds, &rr, &bounds))
+        {
+          graphene_polygon_set_vertices (res, 0, NULL, NULL);
+          return false;
+        }
+
+      graphene_polygon_init_from_rect (res, &bounds);
+      return true;
+    }
+
+  graphene_polygon_set_vertices (res, n, x[cur], y[cur]);
+
+  if (graphene_polygon_get_area (res) <= 0.f)
+    {
+      graphene_polygon_set_vertices (res, 0, NULL, NULL);
+      return false;
+    }
+
+  return true;
+}
@@ -0,0 +1,103 @@
+/* graphene-polygon.h: Convex polygon
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_POLYGON_H__
+#define __GRAPHENE_POLYGON_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-point.h"
+#include "graphene-quad.h"
+#include "graphene-rect.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * GRAPHENE_POLYGON_MAX_VERTICES:
+ *
+ * The maximum number of vertices of a #graphene_polygon_t.
+ *
+ * Since: 1.4
+ */
+#define GRAPHENE_POLYGON_MAX_VERTICES   8
+
+/**
+ * graphene_polygon_t:
+ *
+ * A convex polygon with up to %GRAPHENE_POLYGON_MAX_VERTICES vertices.
+ *
+ * The contents of a #graphene_polygon_t are private and should never be
+ * accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_polygon_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, xs[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, ys[2]);
+  GRAPHENE_PRIVATE_FIELD (unsigned int, n_vertices);
+};
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_polygon_t *    graphene_polygon_alloc                  (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_polygon_free                   (graphene_polygon_t       *p);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_polygon_t *    graphene_polygon_init                   (graphene_polygon_t       *p,
+                                                                 unsigned int              n_points,
+                                                                 const graphene_point_t    points[]);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_polygon_t *    graphene_polygon_init_from_quad         (graphene_polygon_t       *p,
+                                                                 const graphene_quad_t    *q);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_polygon_t *    graphene_polygon_init_from_rect         (graphene_polygon_t       *p,
+                                                                 const graphene_rect_t    *r);
+
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int            graphene_polygon_get_n_vertices         (const graphene_polygon_t *p);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_polygon_get_vertex             (const graphene_polygon_t *p,
+                                                                 unsigned int              index_,
+                                                                 graphene_point_t         *res);
+
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_polygon_contains_point         (const graphene_polygon_t *p,
+                                                                 const graphene_point_t   *point);
+GRAPHENE_AVAILABLE_IN_1_4
+float                   graphene_polygon_get_area               (const graphene_polygon_t *p);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_polygon_get_bounds             (const graphene_polygon_t *p,
+                                                                 graphene_rect_t          *r);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_polygon_intersect_rect         (const graphene_polygon_t *p,
+                                                                 const graphene_rect_t    *r,
+                                                                 graphene_polygon_t       *res);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_POLYGON_H__ */
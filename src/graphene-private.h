@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <float.h>
+#include <stdint.h>
 
 #define GRAPHENE_FLOAT_EPSILON  FLT_EPSILON
 
@@ -120,4 +121,50 @@ graphene_sincos (float angle, float *sin_out, float *cos_out)
 #endif /* HAVE_SINCOSF */
 }
 
+/*< private >
+ * graphene_hash_floats:
+ * @v: an array of floating point values
+ * @n_values: the number of values in @v
+ *
+ * Computes a hash of the bits of the given values, using the 32 bit
+ * variant of MurmurHash3; the hash does not depend on the platform.
+ *
+ * Since -0 and +0 compare equal, the zero values are normalized on
+ * their bits, as a floating point comparison can be optimized away
+ * when building with -ffast-math.
+ */
+static inline unsigned int
+graphene_hash_floats (const float  *v,
+                      unsigned int  n_values)
+{
+  uint32_t h = 0x9747b28c;
+  unsigned int i;
+
+  for (i = 0; i < n_values; i++)
+    {
+      union { float f; uint32_t u; } k;
+
+      k.f = v[i];
+      if ((k.u & 0x7fffffff) == 0)
+        k.u = 0;
+
+      k.u *= 0xcc9e2d51;
+      k.u = (k.u << 15) | (k.u >> 17);
+      k.u *= 0x1b873593;
+
+      h ^= k.u;
+      h = (h << 13) | (h >> 19);
+      h = h * 5 + 0xe6546b64;
+    }
+
+  h ^= n_values * 4;
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+
+  return h;
+}
+
 #endif /* __GRAPHENE_PRIVATE_H__ */
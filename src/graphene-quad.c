@@ -33,6 +33,7 @@
 
 #include "graphene-quad.h"
 
+#include "graphene-alloc-private.h"
 #include "graphene-line-segment-private.h"
 #include "graphene-rect.h"
 #include "graphene-simd4f.h"
@@ -158,17 +159,12 @@ bool
 graphene_quad_contains (const graphene_quad_t  *q,
                         const graphene_point_t *p)
 {
-  graphene_line_segment_t l1, l2, l3, l4;
+  const graphene_point_t *v = q->points;
 
-  l1 = graphene_line_segment_init (&q->points[0], &q->points[1]);
-  l2 = graphene_line_segment_init (&q->points[1], &q->points[2]);
-  l3 = graphene_line_segment_init (&q->points[2], &q->points[3]);
-  l4 = graphene_line_segment_init (&q->points[3], &q->points[0]);
-
-  return graphene_line_segment_points_on_same_side (l1, p, &(q->points[2])) &&
-         graphene_line_segment_points_on_same_side (l2, p, &(q->points[3])) &&
-         graphene_line_segment_points_on_same_side (l3, p, &(q->points[0])) &&
-         graphene_line_segment_points_on_same_side (l4, p, &(q->points[1]));
+  return graphene_line_segment_points_on_same_side_internal (&v[0], &v[1], p, &v[2]) &&
+         graphene_line_segment_points_on_same_side_internal (&v[1], &v[2], p, &v[3]) &&
+         graphene_line_segment_points_on_same_side_internal (&v[2], &v[3], p, &v[0]) &&
+         graphene_line_segment_points_on_same_side_internal (&v[3], &v[0], p, &v[1]);
 }
 
 /**
@@ -217,3 +213,192 @@ graphene_quad_get_point (const graphene_quad_t *q,
 {
   return &q->points[index_];
 }
+
+/**
+ * graphene_prepared_quad_alloc: (constructor)
+ *
+ * Allocates a new #graphene_prepared_quad_t instance.
+ *
+ * The contents of the returned instance are undefined.
+ *
+ * Returns: (transfer full): the newly created #graphene_prepared_quad_t
+ *   instance. Use graphene_prepared_quad_free() to free the resources
+ *   allocated by this function
+ *
+ * Since: 1.4
+ */
+graphene_prepared_quad_t *
+graphene_prepared_quad_alloc (void)
+{
+  return graphene_aligned_alloc0 (sizeof (graphene_prepared_quad_t), 1, 16);
+}
+
+/**
+ * graphene_prepared_quad_free:
+ * @q: a #graphene_prepared_quad_t
+ *
+ * Frees the resources allocated by graphene_prepared_quad_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_prepared_quad_free (graphene_prepared_quad_t *q)
+{
+  graphene_aligned_free (q);
+}
+
+/**
+ * graphene_quad_prepare:
+ * @q: a #graphene_quad_t
+ * @res: (out caller-allocates): return location for the prepared quad
+ *
+ * Computes the edge equations of @q, and stores them into a
+ * #graphene_prepared_quad_t, which can be used to check whether
+ * points are contained inside the quad without recomputing the
+ * edges for every query.
+ *
+ * The results of graphene_prepared_quad_contains() are equivalent to
+ * the ones of graphene_quad_contains(), except for points on, or within
+ * rounding errors of, the edges of the quad: the prepared quad uses
+ * a different formulation of the edge equations, and always considers
+ * the points on its edges as contained.
+ *
+ * Since: 1.4
+ */
+void
+graphene_quad_prepare (const graphene_quad_t    *q,
+                       graphene_prepared_quad_t *res)
+{
+  float a[4], b[4], c[4];
+  int i;
+
+  for (i = 0; i < 4; i++)
+    {
+      const graphene_point_t *start = &q->points[i];
+      const graphene_point_t *end = &q->points[(i + 1) % 4];
+      const graphene_point_t *opposite = &q->points[(i + 2) % 4];
+      float side;
+
+      /* the edge equation is oriented so that the opposite vertex
+       * is on its positive side; if the opposite vertex lies on the
+       * edge, every point passes the test for that edge
+       */
+      a[i] = start->y - end->y;
+      b[i] = end->x - start->x;
+      c[i] = -(a[i] * start->x + b[i] * start->y);
+
+      side = a[i] * opposite->x + b[i] * opposite->y + c[i];
+      if (side < 0.f)
+        {
+          a[i] = -a[i];
+          b[i] = -b[i];
+          c[i] = -c[i];
+        }
+      else if (side == 0.f)
+        {
+          a[i] = b[i] = c[i] = 0.f;
+        }
+    }
+
+  res->edges_x = graphene_simd4f_init_4f (a);
+  res->edges_y = graphene_simd4f_init_4f (b);
+  res->edges_c = graphene_simd4f_init_4f (c);
+}
+
+/**
+ * graphene_prepared_quad_contains:
+ * @q: a #graphene_prepared_quad_t
+ * @p: a #graphene_point_t
+ *
+ * Checks if the given #graphene_prepared_quad_t contains the
+ * given point.
+ *
+ * Returns: `true` if the point is inside the quad
+ *
+ * Since: 1.4
+ */
+bool
+graphene_prepared_quad_contains (const graphene_prepared_quad_t *q,
+                                 const graphene_point_t         *p)
+{
+  graphene_simd4f_t d;
+
+  d = graphene_simd4f_madd (q->edges_x, graphene_simd4f_splat (p->x),
+                            graphene_simd4f_madd (q->edges_y, graphene_simd4f_splat (p->y),
+                                                  q->edges_c));
+
+  return graphene_simd4f_cmp_ge (d, graphene_simd4f_splat (0.f));
+}
+
+/**
+ * graphene_prepared_quad_contains_points:
+ * @q: a #graphene_prepared_quad_t
+ * @n_points: the number of points in @points
+ * @points: (array length=n_points): an array of #graphene_point_t
+ * @res: (array length=n_points) (out caller-allocates): return location
+ *   for the results of the containment test of each point
+ *
+ * Checks whether the points in the given array are contained inside
+ * the #graphene_prepared_quad_t.
+ *
+ * The points are tested four at a time, with each of the four edges
+ * evaluated for all the points at once.
+ *
+ * Returns: the number of points contained inside the quad
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_prepared_quad_contains_points (const graphene_prepared_quad_t *q,
+                                        unsigned int                    n_points,
+                                        const graphene_point_t          points[],
+                                        bool                            res[])
+{
+  graphene_simd4f_t e_x[4], e_y[4], e_c[4];
+  float a[4], b[4], c[4], d[4];
+  unsigned int i, j, n_inside = 0;
+
+  graphene_simd4f_dup_4f (q->edges_x, a);
+  graphene_simd4f_dup_4f (q->edges_y, b);
+  graphene_simd4f_dup_4f (q->edges_c, c);
+
+  /* each edge equation, broadcast to all lanes */
+  for (j = 0; j < 4; j++)
+    {
+      e_x[j] = graphene_simd4f_splat (a[j]);
+      e_y[j] = graphene_simd4f_splat (b[j]);
+      e_c[j] = graphene_simd4f_splat (c[j]);
+    }
+
+  for (i = 0; i + 4 <= n_points; i += 4)
+    {
+      const graphene_simd4f_t xs = graphene_simd4f_init (points[i + 0].x, points[i + 1].x,
+                                                         points[i + 2].x, points[i + 3].x);
+      const graphene_simd4f_t ys = graphene_simd4f_init (points[i + 0].y, points[i + 1].y,
+                                                         points[i + 2].y, points[i + 3].y);
+      graphene_simd4f_t dist;
+
+      /* the minimum distance of each point over the four edges */
+      dist = graphene_simd4f_madd (e_x[0], xs, graphene_simd4f_madd (e_y[0], ys, e_c[0]));
+      for (j = 1; j < 4; j++)
+        dist = graphene_simd4f_min (dist,
+                                    graphene_simd4f_madd (e_x[j], xs,
+                                                          graphene_simd4f_madd (e_y[j], ys, e_c[j])));
+
+      graphene_simd4f_dup_4f (dist, d);
+
+      for (j = 0; j < 4; j++)
+        {
+          res[i + j] = d[j] >= 0.f;
+          n_inside += res[i + j] ? 1 : 0;
+        }
+    }
+
+  for (; i < n_points; i++)
+    {
+      res[i] = graphene_prepared_quad_contains (q, &points[i]);
+      n_inside += res[i] ? 1 : 0;
+    }
+
+  return n_inside;
+}
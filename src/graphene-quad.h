@@ -45,6 +45,25 @@ struct _graphene_quad_t
   GRAPHENE_PRIVATE_FIELD (graphene_point_t, points[4]);
 };
 
+/**
+ * graphene_prepared_quad_t:
+ *
+ * A #graphene_quad_t prepared for repeated point containment tests;
+ * see graphene_quad_prepare().
+ *
+ * The contents of a #graphene_prepared_quad_t are private and should
+ * never be accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_prepared_quad_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, edges_x);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, edges_y);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, edges_c);
+};
+
 GRAPHENE_AVAILABLE_IN_1_0
 graphene_quad_t *       graphene_quad_alloc             (void);
 GRAPHENE_AVAILABLE_IN_1_0
@@ -75,6 +94,23 @@ GRAPHENE_AVAILABLE_IN_1_0
 const graphene_point_t *graphene_quad_get_point         (const graphene_quad_t  *q,
                                                          unsigned int            index_);
 
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_prepared_quad_t *graphene_prepared_quad_alloc  (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_prepared_quad_free     (graphene_prepared_quad_t       *q);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_quad_prepare           (const graphene_quad_t          *q,
+                                                         graphene_prepared_quad_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_prepared_quad_contains (const graphene_prepared_quad_t *q,
+                                                         const graphene_point_t         *p);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int            graphene_prepared_quad_contains_points (const graphene_prepared_quad_t *q,
+                                                                unsigned int                    n_points,
+                                                                const graphene_point_t          points[],
+                                                                bool                            res[]);
+
 GRAPHENE_END_DECLS
 
 #endif /* __GRAPHENE_QUAD_H__ */
@@ -0,0 +1,249 @@
+/* graphene-quaternion-private.h: Quaternion operations in SIMD registers
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_QUATERNION_PRIVATE_H__
+#define __GRAPHENE_QUATERNION_PRIVATE_H__
+
+#include "graphene-private.h"
+
+#include "graphene-quaternion.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+#include <math.h>
+
+/* the public #graphene_quaternion_t structure stores four floats, to
+ * keep its size and alignment; internally, we load it into a SIMD
+ * register with a single unaligned load, and perform all operations
+ * on the register, storing it back only at the end
+ */
+
+static inline graphene_simd4f_t
+graphene_quaternion_load (const graphene_quaternion_t *q)
+{
+  return graphene_simd4f_init_4f ((const float *) q);
+}
+
+static inline void
+graphene_quaternion_store (const graphene_simd4f_t  v,
+                           graphene_quaternion_t   *q)
+{
+  graphene_simd4f_dup_4f (v, (float *) q);
+}
+
+static inline float
+graphene_quaternion_simd_dot (const graphene_simd4f_t a,
+                              const graphene_simd4f_t b)
+{
+  return graphene_simd4f_get_x (graphene_simd4f_dot4 (a, b));
+}
+
+static inline graphene_simd4f_t
+graphene_quaternion_simd_normalize (const graphene_simd4f_t q)
+{
+  return graphene_simd4f_normalize4 (q);
+}
+
+static inline graphene_simd4f_t
+graphene_quaternion_simd_invert (const graphene_simd4f_t q)
+{
+  return graphene_simd4f_mul (q, graphene_simd4f_init (-1.f, -1.f, -1.f, 1.f));
+}
+
+static inline graphene_simd4f_t
+graphene_quaternion_simd_slerp (const graphene_simd4f_t a,
+                                const graphene_simd4f_t b,
+                                float                   factor)
+{
+  float dot, theta, r_sin_theta, sin_t, cos_t, right_v, left_v;
+
+  dot = CLAMP (graphene_quaternion_simd_dot (a, b), -1.f, 1.f);
+  if (dot == 1.f)
+    return a;
+
+  theta = acosf (dot);
+  r_sin_theta = 1.f / sqrtf (1.f - dot * dot);
+
+  graphene_sincos (factor * theta, &sin_t, &cos_t);
+  right_v = sin_t * r_sin_theta;
+  left_v = cos_t - dot * right_v;
+
+  return graphene_simd4f_madd (a, graphene_simd4f_splat (left_v),
+                               graphene_simd4f_mul (b, graphene_simd4f_splat (right_v)));
+}
+
+static inline graphene_simd4f_t
+graphene_quaternion_simd_multiply (const graphene_simd4f_t a,
+                                   const graphene_simd4f_t b)
+{
+  const graphene_simd4f_t unit_w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  graphene_simd4f_t res, dot;
+
+  /* the vector part is a.w * b + b.w * a + a × b; the scalar part
+   * is a.w * b.w - a · b, and since the first term already contains
+   * 2 * a.w * b.w in the W component, we can subtract the four
+   * components dot product from it
+   */
+  res = graphene_simd4f_madd (graphene_simd4f_splat_w (a), b,
+                              graphene_simd4f_mul (graphene_simd4f_splat_w (b), a));
+  res = graphene_simd4f_add (res, graphene_simd4f_cross3 (a, b));
+
+  dot = graphene_simd4f_dot4 (a, b);
+
+  return graphene_simd4f_sub (res, graphene_simd4f_mul (dot, unit_w));
+}
+
+static inline graphene_simd4f_t
+graphene_quaternion_simd_rotate (const graphene_simd4f_t q,
+                                 const graphene_simd4f_t q_w,
+                                 const graphene_simd4f_t v)
+{
+  graphene_simd4f_t t;
+
+  /* v' = v + w * t + q × t, with t = 2 * (q × v) */
+  t = graphene_simd4f_cross3 (q, v);
+  t = graphene_simd4f_add (t, t);
+
+  return graphene_simd4f_add (graphene_simd4f_madd (q_w, t, v),
+                              graphene_simd4f_cross3 (q, t));
+}
+
+/* the translation of the rigid transformation described by the unit
+ * dual quaternion (r, d) is the vector part of 2 * d * r̄, which is
+ * 2 * (r.w * d - d.w * r + r × d)
+ */
+static inline graphene_simd4f_t
+graphene_dual_quaternion_simd_translation (const graphene_simd4f_t r,
+                                           const graphene_simd4f_t d)
+{
+  graphene_simd4f_t t;
+
+  t = graphene_simd4f_sub (graphene_simd4f_mul (graphene_simd4f_splat_w (r), d),
+                           graphene_simd4f_mul (graphene_simd4f_splat_w (d), r));
+  t = graphene_simd4f_add (t, graphene_simd4f_cross3 (r, d));
+
+  return graphene_simd4f_zero_w (graphene_simd4f_add (t, t));
+}
+
+/* selects, for each lane, the lane of @t if @a is greater than or
+ * equal to @b, and the lane of @f otherwise, using a comparison mask
+ */
+static inline graphene_simd4f_t
+graphene_quaternion_simd_select_ge (const graphene_simd4f_t a,
+                                    const graphene_simd4f_t b,
+                                    const graphene_simd4f_t t,
+                                    const graphene_simd4f_t f)
+{
+#if !defined(__GI_SCANNER__) && defined(GRAPHENE_USE_SSE)
+  const graphene_simd4f_t mask = _mm_cmpge_ps (a, b);
+
+  return _mm_or_ps (_mm_and_ps (mask, t), _mm_andnot_ps (mask, f));
+#elif !defined(__GI_SCANNER__) && defined(GRAPHENE_USE_GCC)
+  const graphene_simd4i_t mask = a >= b;
+
+  return (graphene_simd4f_t) (((graphene_simd4i_t) t & mask) | ((graphene_simd4i_t) f & ~mask));
+#elif !defined(__GI_SCANNER__) && defined(GRAPHENE_USE_ARM_NEON)
+  return vbslq_f32 (vcgeq_f32 (a, b), t, f);
+#else
+  graphene_simd4f_t res;
+
+  res.x = a.x >= b.x ? t.x : f.x;
+  res.y = a.y >= b.y ? t.y : f.y;
+  res.z = a.z >= b.z ? t.z : f.z;
+  res.w = a.w >= b.w ? t.w : f.w;
+
+  return res;
+#endif
+}
+
+/* extracts the unit quaternion of a rotation matrix using Shepperd's
+ * method: each row of the symmetric matrix K below is 4 * q[i] * q, so
+ * normalizing the row with the largest diagonal term 4 * q[i]² yields q
+ * without dividing by a small component, even for rotations near 180°.
+ *
+ * With r the upper 3x3 part of the matrix and t its trace, the first
+ * three rows of K are the rows of r + rᵀ, with 1 - t added on the
+ * diagonal and the vector k = (r12 - r21, r20 - r02, r01 - r10) in the
+ * last column; the last row is k, with 1 + t in the last column. The
+ * row is selected with comparison masks, and the result is kept in the
+ * w ≥ 0 hemisphere
+ */
+static inline graphene_simd4f_t
+graphene_quaternion_simd_from_matrix (const graphene_simd4x4f_t *m)
+{
+  const graphene_simd4f_t zero = graphene_simd4f_init_zero ();
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  const graphene_simd4f_t unit_x = graphene_simd4f_init (1.f, 0.f, 0.f, 0.f);
+  const graphene_simd4f_t unit_y = graphene_simd4f_init (0.f, 1.f, 0.f, 0.f);
+  const graphene_simd4f_t unit_z = graphene_simd4f_init (0.f, 0.f, 1.f, 0.f);
+  const graphene_simd4f_t unit_w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  graphene_simd4f_t diag, trace, c, k, k_x, k_y, k_z, d, d_max;
+  graphene_simd4f_t k_0, k_1, k_2, k_3, res;
+  graphene_simd4x4f_t r, r_t;
+
+  r = graphene_simd4x4f_init (graphene_simd4f_zero_w (m->x),
+                              graphene_simd4f_zero_w (m->y),
+                              graphene_simd4f_zero_w (m->z),
+                              zero);
+  graphene_simd4x4f_transpose (&r, &r_t);
+
+  diag = graphene_simd4f_mul (r.x, unit_x);
+  diag = graphene_simd4f_madd (r.y, unit_y, diag);
+  diag = graphene_simd4f_madd (r.z, unit_z, diag);
+  trace = graphene_simd4f_dot3 (diag, one);
+  c = graphene_simd4f_sub (one, trace);
+
+  /* k = Σ eᵢ × rᵢ */
+  k_x = graphene_simd4f_cross3 (unit_x, r.x);
+  k_y = graphene_simd4f_cross3 (unit_y, r.y);
+  k_z = graphene_simd4f_cross3 (unit_z, r.z);
+  k = graphene_simd4f_zero_w (graphene_simd4f_add (graphene_simd4f_add (k_x, k_y), k_z));
+
+  /* the diagonal of K */
+  d = graphene_simd4f_add (c, graphene_simd4f_add (diag, diag));
+  d = graphene_simd4f_madd (trace, graphene_simd4f_add (unit_w, unit_w), d);
+
+  d_max = graphene_simd4f_max (d, graphene_simd4f_shuffle_zwxy (d));
+  d_max = graphene_simd4f_max (d_max, graphene_simd4f_shuffle_yzwx (d_max));
+
+  /* the rows of K */
+  k_0 = graphene_simd4f_madd (c, unit_x, graphene_simd4f_mul (graphene_simd4f_splat_x (k), unit_w));
+  k_0 = graphene_simd4f_add (k_0, graphene_simd4f_add (r.x, r_t.x));
+  k_1 = graphene_simd4f_madd (c, unit_y, graphene_simd4f_mul (graphene_simd4f_splat_y (k), unit_w));
+  k_1 = graphene_simd4f_add (k_1, graphene_simd4f_add (r.y, r_t.y));
+  k_2 = graphene_simd4f_madd (c, unit_z, graphene_simd4f_mul (graphene_simd4f_splat_z (k), unit_w));
+  k_2 = graphene_simd4f_add (k_2, graphene_simd4f_add (r.z, r_t.z));
+  k_3 = graphene_simd4f_madd (graphene_simd4f_splat_w (d), unit_w, k);
+
+  /* on ties, the last row wins */
+  res = graphene_quaternion_simd_select_ge (graphene_simd4f_splat_y (d), d_max, k_1, k_0);
+  res = graphene_quaternion_simd_select_ge (graphene_simd4f_splat_z (d), d_max, k_2, res);
+  res = graphene_quaternion_simd_select_ge (graphene_simd4f_splat_w (d), d_max, k_3, res);
+
+  res = graphene_quaternion_simd_select_ge (graphene_simd4f_splat_w (res), zero,
+                                            res, graphene_simd4f_neg (res));
+
+  return graphene_simd4f_normalize4 (res);
+}
+
+#endif /* __GRAPHENE_QUATERNION_PRIVATE_H__ */
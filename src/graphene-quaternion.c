@@ -37,6 +37,7 @@
 #include "graphene-private.h"
 
 #include "graphene-quaternion.h"
+#include "graphene-quaternion-private.h"
 
 #include "graphene-euler.h"
 #include "graphene-matrix.h"
@@ -148,15 +149,6 @@ graphene_quaternion_init_from_quaternion (graphene_quaternion_t       *q,
   return q;
 }
 
-static graphene_quaternion_t *
-graphene_quaternion_init_from_simd4f (graphene_quaternion_t *q,
-                                      graphene_simd4f_t      v)
-{
-  graphene_simd4f_dup_4f (v, (float *) q);
-
-  return q;
-}
-
 /**
  * graphene_quaternion_init_from_vec4:
  * @q: a #graphene_quaternion_t
@@ -172,7 +164,9 @@ graphene_quaternion_t *
 graphene_quaternion_init_from_vec4 (graphene_quaternion_t *q,
                                     const graphene_vec4_t *src)
 {
-  return graphene_quaternion_init_from_simd4f (q, src->value);
+  graphene_quaternion_store (src->value, q);
+
+  return q;
 }
 
 /**
@@ -190,7 +184,7 @@ void
 graphene_quaternion_to_vec4 (const graphene_quaternion_t *q,
                              graphene_vec4_t             *res)
 {
-  res->value = graphene_simd4f_init (q->x, q->y, q->z, q->w);
+  res->value = graphene_quaternion_load (q);
 }
 
 /**
@@ -209,25 +203,7 @@ graphene_quaternion_t *
 graphene_quaternion_init_from_matrix (graphene_quaternion_t   *q,
                                       const graphene_matrix_t *m)
 {
-  float xx, yy, zz;
-
-  xx = graphene_matrix_get_value (m, 0, 0);
-  yy = graphene_matrix_get_value (m, 1, 1);
-  zz = graphene_matrix_get_value (m, 2, 2);
-
-  q->w = 0.5f * sqrtf (MAX (1 + xx + yy + zz, 0.f));
-  q->x = 0.5f * sqrtf (MAX (1 + xx - yy - zz, 0.f));
-  q->y = 0.5f * sqrtf (MAX (1 - xx + yy - zz, 0.f));
-  q->z = 0.5f * sqrtf (MAX (1 - xx - yy + zz, 0.f));
-
-  if (graphene_matrix_get_value (m, 2, 1) > graphene_matrix_get_value (m, 1, 2))
-    q->x = -q->x;
-
-  if (graphene_matrix_get_value (m, 0, 2) > graphene_matrix_get_value (m, 2, 0))
-    q->y = -q->y;
-
-  if (graphene_matrix_get_value (m, 1, 0) > graphene_matrix_get_value (m, 0, 1))
-    q->z = -q->z;
+  graphene_quaternion_store (graphene_quaternion_simd_from_matrix (&m->value), q);
 
   return q;
 }
@@ -281,32 +257,98 @@ graphene_quaternion_slerp (const graphene_quaternion_t *a,
                            float                        factor,
                            graphene_quaternion_t       *res)
 {
-  float theta, r_sin_theta, right_v, left_v, dot;
-  graphene_simd4f_t v_a, v_b, left, right, sum;
+  graphene_simd4f_t v_a, v_b;
 
-  v_a = graphene_simd4f_init (a->x, a->y, a->z, a->w);
-  v_b = graphene_simd4f_init (b->x, b->y, b->z, b->w);
+  v_a = graphene_quaternion_load (a);
+  v_b = graphene_quaternion_load (b);
 
-  dot = CLAMP (graphene_simd4f_get_x (graphene_simd4f_dot4 (v_a, v_b)), -1.f, 1.f);
-  if (dot == 1.f)
-    {
-      *res = *a;
-      return;
-    }
+  graphene_quaternion_store (graphene_quaternion_simd_slerp (v_a, v_b, factor), res);
+}
 
-  theta = acos (dot);
-  r_sin_theta = 1.f / sqrtf (1.f - dot * dot);
-  right_v = sinf (factor * theta) * r_sin_theta;
-  left_v = cosf (factor * theta) - dot * right_v;
+/**
+ * graphene_quaternion_multiply:
+ * @a: a #graphene_quaternion_t
+ * @b: a #graphene_quaternion_t
+ * @res: (out caller-allocates): return location for the product
+ *   of the two quaternions
+ *
+ * Computes the Hamilton product of two #graphene_quaternion_t.
+ *
+ * The rotation described by the resulting quaternion is equivalent
+ * to the rotation described by @b, followed by the rotation described
+ * by @a.
+ *
+ * Since: 1.4
+ */
+void
+graphene_quaternion_multiply (const graphene_quaternion_t *a,
+                              const graphene_quaternion_t *b,
+                              graphene_quaternion_t       *res)
+{
+  graphene_simd4f_t v_a, v_b;
 
-  left = graphene_simd4f_init (a->x, a->y, a->z, a->w);
-  right = graphene_simd4f_init (b->x, b->y, b->z, b->w);
+  v_a = graphene_quaternion_load (a);
+  v_b = graphene_quaternion_load (b);
 
-  left = graphene_simd4f_mul (left, graphene_simd4f_splat (left_v));
-  right = graphene_simd4f_mul (right, graphene_simd4f_splat (right_v));
-  sum = graphene_simd4f_add (left, right);
+  graphene_quaternion_store (graphene_quaternion_simd_multiply (v_a, v_b), res);
+}
 
-  graphene_quaternion_init_from_simd4f (res, sum);
+/**
+ * graphene_quaternion_rotate_vec3:
+ * @q: a #graphene_quaternion_t
+ * @v: a #graphene_vec3_t
+ * @res: (out caller-allocates): return location for the rotated vector
+ *
+ * Rotates the vector @v using the rotation described by the unit
+ * quaternion @q.
+ *
+ * The result is the same as transforming @v with the matrix obtained
+ * from graphene_quaternion_to_matrix(), but it does not require
+ * building the matrix.
+ *
+ * Since: 1.4
+ */
+void
+graphene_quaternion_rotate_vec3 (const graphene_quaternion_t *q,
+                                 const graphene_vec3_t       *v,
+                                 graphene_vec3_t             *res)
+{
+  graphene_simd4f_t v_q;
+
+  v_q = graphene_quaternion_load (q);
+
+  res->value = graphene_quaternion_simd_rotate (v_q, graphene_simd4f_splat_w (v_q), v->value);
+}
+
+/**
+ * graphene_quaternion_rotate_vec3_array:
+ * @q: a #graphene_quaternion_t
+ * @n_vectors: the number of vectors
+ * @v: (array length=n_vectors): an array of #graphene_vec3_t
+ * @res: (array length=n_vectors) (out caller-allocates): return
+ *   location for the rotated vectors
+ *
+ * Rotates each vector in the @v array using the rotation described
+ * by the unit quaternion @q; see graphene_quaternion_rotate_vec3().
+ *
+ * The @v and @res arrays can be the same.
+ *
+ * Since: 1.4
+ */
+void
+graphene_quaternion_rotate_vec3_array (const graphene_quaternion_t *q,
+                                       unsigned int                 n_vectors,
+                                       const graphene_vec3_t        v[],
+                                       graphene_vec3_t              res[])
+{
+  graphene_simd4f_t v_q, q_w;
+  unsigned int i;
+
+  v_q = graphene_quaternion_load (q);
+  q_w = graphene_simd4f_splat_w (v_q);
+
+  for (i = 0; i < n_vectors; i++)
+    res[i].value = graphene_quaternion_simd_rotate (v_q, q_w, v[i].value);
 }
 
 /**
@@ -486,10 +528,7 @@ graphene_quaternion_init_from_angle_vec3 (graphene_quaternion_t *q,
   axis_n = graphene_simd4f_mul (graphene_simd4f_normalize3 (axis->value),
                                 graphene_simd4f_splat (sin_a));
 
-  q->x = graphene_simd4f_get_x (axis_n);
-  q->y = graphene_simd4f_get_y (axis_n);
-  q->z = graphene_simd4f_get_z (axis_n);
-  q->w = cos_a;
+  graphene_quaternion_store (graphene_simd4f_merge_w (axis_n, cos_a), q);
 
   return q;
 }
@@ -636,16 +675,18 @@ bool
 graphene_quaternion_equal (const graphene_quaternion_t *a,
                            const graphene_quaternion_t *b)
 {
+  graphene_simd4f_t v_d;
+
   if (a == b)
     return true;
 
   if (a == NULL || b == NULL)
     return false;
 
-  return fabsf (a->x - b->x) < 0.00001 &&
-         fabsf (a->y - b->y) < 0.00001 &&
-         fabsf (a->z - b->z) < 0.00001 &&
-         fabsf (a->w - b->w) < 0.00001;
+  v_d = graphene_simd4f_sub (graphene_quaternion_load (a), graphene_quaternion_load (b));
+  v_d = graphene_simd4f_max (v_d, graphene_simd4f_neg (v_d));
+
+  return graphene_simd4f_cmp_lt (v_d, graphene_simd4f_splat (0.00001f));
 }
 
 /**
@@ -663,12 +704,8 @@ float
 graphene_quaternion_dot (const graphene_quaternion_t *a,
                          const graphene_quaternion_t *b)
 {
-  graphene_simd4f_t v_a, v_b;
-
-  v_a = graphene_simd4f_init (a->x, a->y, a->z, a->w);
-  v_b = graphene_simd4f_init (b->x, b->y, b->z, b->w);
-
-  return graphene_simd4f_get_x (graphene_simd4f_dot4 (v_a, v_b));
+  return graphene_quaternion_simd_dot (graphene_quaternion_load (a),
+                                       graphene_quaternion_load (b));
 }
 
 /**
@@ -685,10 +722,7 @@ void
 graphene_quaternion_invert (const graphene_quaternion_t *q,
                             graphene_quaternion_t       *res)
 {
-  res->x = -q->x;
-  res->y = -q->y;
-  res->z = -q->z;
-  res->w = q->w;
+  graphene_quaternion_store (graphene_quaternion_simd_invert (graphene_quaternion_load (q)), res);
 }
 
 /**
@@ -705,10 +739,384 @@ void
 graphene_quaternion_normalize (const graphene_quaternion_t *q,
                                graphene_quaternion_t       *res)
 {
-  graphene_simd4f_t v_q;
+  graphene_quaternion_store (graphene_quaternion_simd_normalize (graphene_quaternion_load (q)), res);
+}
+
+/*< private >
+ * quaternion_load_soa:
+ * @q: an array of #graphene_quaternion_t
+ * @n: the number of quaternions to load, up to 4
+ * @res: (out): return location for the transposed quaternions
+ *
+ * Loads up to four quaternions and transposes them, so that each
+ * row of @res contains the same component of every quaternion.
+ *
+ * Missing quaternions are replaced by the identity.
+ */
+static inline void
+quaternion_load_soa (const graphene_quaternion_t  q[],
+                     unsigned int                 n,
+                     graphene_simd4x4f_t         *res)
+{
+  const graphene_simd4f_t identity = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+
+  res->x = graphene_quaternion_load (&q[0]);
+  res->y = n > 1 ? graphene_quaternion_load (&q[1]) : identity;
+  res->z = n > 2 ? graphene_quaternion_load (&q[2]) : identity;
+  res->w = n > 3 ? graphene_quaternion_load (&q[3]) : identity;
+
+  graphene_simd4x4f_transpose_in_place (res);
+}
+
+/*< private >
+ * quaternion_store_soa:
+ * @m: the transposed quaternions
+ * @n: the number of quaternions to store, up to 4
+ * @res: (out): return location for the quaternions
+ *
+ * Transposes the rows of @m back and stores the first @n quaternions.
+ */
+static inline void
+quaternion_store_soa (const graphene_simd4x4f_t *m,
+                      unsigned int               n,
+                      graphene_quaternion_t      res[])
+{
+  graphene_simd4x4f_t t;
 
-  v_q = graphene_simd4f_init (q->x, q->y, q->z, q->w);
-  v_q = graphene_simd4f_normalize4 (v_q);
+  graphene_simd4x4f_transpose (m, &t);
+
+  graphene_quaternion_store (t.x, &res[0]);
+  if (n > 1)
+    graphene_quaternion_store (t.y, &res[1]);
+  if (n > 2)
+    graphene_quaternion_store (t.z, &res[2]);
+  if (n > 3)
+    graphene_quaternion_store (t.w, &res[3]);
+}
+
+static inline graphene_simd4f_t
+quaternion_load_factors (const float  factors[],
+                         unsigned int n)
+{
+  float f[4] = { 0.f, 0.f, 0.f, 0.f };
+  unsigned int i;
+
+  if (n == 4)
+    return graphene_simd4f_init_4f (factors);
+
+  for (i = 0; i < n; i++)
+    f[i] = factors[i];
+
+  return graphene_simd4f_init_4f (f);
+}
 
-  graphene_quaternion_init_from_simd4f (res, v_q);
+/*< private >
+ * quaternion_blend_soa:
+ * @a: the transposed start quaternions
+ * @b: the transposed end quaternions
+ * @left: the weights of @a
+ * @right: the weights of @b
+ * @res: (out): return location for the transposed blended quaternions
+ */
+static inline void
+quaternion_blend_soa (const graphene_simd4x4f_t *a,
+                      const graphene_simd4x4f_t *b,
+                      const graphene_simd4f_t    left,
+                      const graphene_simd4f_t    right,
+                      graphene_simd4x4f_t       *res)
+{
+  res->x = graphene_simd4f_madd (a->x, left, graphene_simd4f_mul (b->x, right));
+  res->y = graphene_simd4f_madd (a->y, left, graphene_simd4f_mul (b->y, right));
+  res->z = graphene_simd4f_madd (a->z, left, graphene_simd4f_mul (b->z, right));
+  res->w = graphene_simd4f_madd (a->w, left, graphene_simd4f_mul (b->w, right));
+}
+
+static inline graphene_simd4f_t
+quaternion_dot_soa (const graphene_simd4x4f_t *a,
+                    const graphene_simd4x4f_t *b)
+{
+  graphene_simd4f_t res;
+
+  res = graphene_simd4f_mul (a->x, b->x);
+  res = graphene_simd4f_madd (a->y, b->y, res);
+  res = graphene_simd4f_madd (a->z, b->z, res);
+  res = graphene_simd4f_madd (a->w, b->w, res);
+
+  return res;
+}
+
+/**
+ * graphene_quaternion_slerp_array:
+ * @n_quaternions: the number of quaternions
+ * @a: (array length=n_quaternions): an array of initial quaternions
+ * @b: (array length=n_quaternions): an array of final quaternions
+ * @factors: (array length=n_quaternions): an array of interpolation
+ *   factors, each between 0 and 1
+ * @res: (array length=n_quaternions) (out caller-allocates): return
+ *   location for the interpolated quaternions
+ *
+ * Interpolates each pair of quaternions in the @a and @b arrays using
+ * the corresponding factor in the @factors array, and stores the result
+ * in the @res array; see graphene_quaternion_slerp().
+ *
+ * The quaternions are processed four at a time; the @res array can be
+ * the same as the @a or @b arrays.
+ *
+ * Since: 1.4
+ */
+void
+graphene_quaternion_slerp_array (unsigned int                n_quaternions,
+                                 const graphene_quaternion_t a[],
+                                 const graphene_quaternion_t b[],
+                                 const float                 factors[],
+                                 graphene_quaternion_t       res[])
+{
+  unsigned int i;
+
+  for (i = 0; i < n_quaternions; i += 4)
+    {
+      unsigned int n = MIN (n_quaternions - i, 4);
+      graphene_simd4x4f_t v_a, v_b, v_res;
+      graphene_simd4f_t v;
+      float dot[4], factor[4], left[4], right[4];
+      unsigned int j;
+
+      quaternion_load_soa (a + i, n, &v_a);
+      quaternion_load_soa (b + i, n, &v_b);
+
+      v = quaternion_dot_soa (&v_a, &v_b);
+      graphene_simd4f_dup_4f (v, dot);
+      v = quaternion_load_factors (factors + i, n);
+      graphene_simd4f_dup_4f (v, factor);
+
+      /* the trigonometric functions are computed on each lane, but
+       * everything else happens on the transposed quaternions
+       */
+      for (j = 0; j < 4; j++)
+        {
+          float d = CLAMP (dot[j], -1.f, 1.f);
+          float theta, r_sin_theta, sin_t, cos_t;
+
+          if (d == 1.f)
+            {
+              left[j] = 1.f;
+              right[j] = 0.f;
+              continue;
+            }
+
+          theta = acosf (d);
+          r_sin_theta = 1.f / sqrtf (1.f - d * d);
+
+          graphene_sincos (factor[j] * theta, &sin_t, &cos_t);
+          right[j] = sin_t * r_sin_theta;
+          left[j] = cos_t - d * right[j];
+        }
+
+      quaternion_blend_soa (&v_a, &v_b,
+                            graphene_simd4f_init_4f (left),
+                            graphene_simd4f_init_4f (right),
+                            &v_res);
+
+      quaternion_store_soa (&v_res, n, res + i);
+    }
+}
+
+/**
+ * graphene_quaternion_nlerp_array:
+ * @n_quaternions: the number of quaternions
+ * @a: (array length=n_quaternions): an array of initial quaternions
+ * @b: (array length=n_quaternions): an array of final quaternions
+ * @factors: (array length=n_quaternions): an array of interpolation
+ *   factors, each between 0 and 1
+ * @res: (array length=n_quaternions) (out caller-allocates): return
+ *   location for the interpolated quaternions
+ *
+ * Interpolates each pair of quaternions in the @a and @b arrays using
+ * the corresponding factor in the @factors array, and stores the result
+ * in the @res array.
+ *
+ * This function performs a normalized linear interpolation, with the
+ * factor corrected by a polynomial fit of the spherical interpolation,
+ * and it does not require any trigonometric function; the angle between
+ * the result and the spherical interpolation is below 1e-3 radians.
+ *
+ * Unlike graphene_quaternion_slerp(), this function always interpolates
+ * along the shortest path between the two rotations, by negating the
+ * final quaternion if needed.
+ *
+ * The quaternions are processed four at a time; the @res array can be
+ * the same as the @a or @b arrays.
+ *
+ * Since: 1.4
+ */
+void
+graphene_quaternion_nlerp_array (unsigned int                n_quaternions,
+                                 const graphene_quaternion_t a[],
+                                 const graphene_quaternion_t b[],
+                                 const float                 factors[],
+                                 graphene_quaternion_t       res[])
+{
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  const graphene_simd4f_t half = graphene_simd4f_splat (0.5f);
+  unsigned int i;
+
+  for (i = 0; i < n_quaternions; i += 4)
+    {
+      unsigned int n = MIN (n_quaternions - i, 4);
+      graphene_simd4x4f_t v_a, v_b, v_res;
+      graphene_simd4f_t t, t_h, dot, d, k_a, k_b, k, sign, inv_len;
+      float dot_f[4];
+
+      quaternion_load_soa (a + i, n, &v_a);
+      quaternion_load_soa (b + i, n, &v_b);
+
+      t = quaternion_load_factors (factors + i, n);
+
+      dot = quaternion_dot_soa (&v_a, &v_b);
+      d = graphene_simd4f_max (dot, graphene_simd4f_neg (dot));
+
+      graphene_simd4f_dup_4f (dot, dot_f);
+      sign = graphene_simd4f_init (dot_f[0] < 0.f ? -1.f : 1.f,
+                                   dot_f[1] < 0.f ? -1.f : 1.f,
+                                   dot_f[2] < 0.f ? -1.f : 1.f,
+                                   dot_f[3] < 0.f ? -1.f : 1.f);
+
+      /* the factor correction is a cubic in t that vanishes at 0, 1/2,
+       * and 1; its coefficient is fitted against the cosine of the
+       * angle between the two quaternions, so that the normalized
+       * linear interpolation follows the constant angular velocity of
+       * the spherical one
+       */
+      k_a = graphene_simd4f_madd (d, graphene_simd4f_splat (-1.43519f), graphene_simd4f_splat (3.55645f));
+      k_a = graphene_simd4f_madd (d, k_a, graphene_simd4f_splat (-3.2452f));
+      k_a = graphene_simd4f_madd (d, k_a, graphene_simd4f_splat (1.0904f));
+
+      k_b = graphene_simd4f_madd (d, graphene_simd4f_splat (0.215638f), graphene_simd4f_splat (-1.06021f));
+      k_b = graphene_simd4f_madd (d, k_b, graphene_simd4f_splat (0.848013f));
+
+      t_h = graphene_simd4f_sub (t, half);
+      k = graphene_simd4f_madd (graphene_simd4f_mul (k_a, t_h), t_h, k_b);
+      k = graphene_simd4f_mul (k, graphene_simd4f_mul (t_h, graphene_simd4f_sub (t, one)));
+      t = graphene_simd4f_madd (t, k, t);
+
+      quaternion_blend_soa (&v_a, &v_b,
+                            graphene_simd4f_sub (one, t),
+                            graphene_simd4f_mul (t, sign),
+                            &v_res);
+
+      inv_len = graphene_simd4f_rsqrt (quaternion_dot_soa (&v_res, &v_res));
+      v_res.x = graphene_simd4f_mul (v_res.x, inv_len);
+      v_res.y = graphene_simd4f_mul (v_res.y, inv_len);
+      v_res.z = graphene_simd4f_mul (v_res.z, inv_len);
+      v_res.w = graphene_simd4f_mul (v_res.w, inv_len);
+
+      quaternion_store_soa (&v_res, n, res + i);
+    }
+}
+
+/**
+ * graphene_quaternion_init_from_matrix_array:
+ * @n_matrices: the number of matrices
+ * @m: (array length=n_matrices): an array of rotation matrices
+ * @res: (array length=n_matrices) (out caller-allocates): return
+ *   location for the quaternions
+ *
+ * Initializes each quaternion in the @res array using the rotation
+ * components of the corresponding matrix in the @m array.
+ *
+ * This is the equivalent of calling graphene_quaternion_init_from_matrix()
+ * on each matrix; the matrices are converted four at a time, reading the
+ * rotation components directly from their rows.
+ *
+ * Since: 1.4
+ */
+void
+graphene_quaternion_init_from_matrix_array (unsigned int            n_matrices,
+                                            const graphene_matrix_t m[],
+                                            graphene_quaternion_t   res[])
+{
+  const graphene_simd4f_t zero = graphene_simd4f_init_zero ();
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  unsigned int i;
+
+  for (i = 0; i < n_matrices; i += 4)
+    {
+      unsigned int n = MIN (n_matrices - i, 4);
+      const graphene_matrix_t *m1 = n > 1 ? &m[i + 1] : &m[i];
+      const graphene_matrix_t *m2 = n > 2 ? &m[i + 2] : &m[i];
+      const graphene_matrix_t *m3 = n > 3 ? &m[i + 3] : &m[i];
+      graphene_simd4x4f_t rows, v_res;
+      graphene_simd4f_t r[9], trace, c, d_0, d_1, d_2, d_3, d_max, d_max_hi;
+      graphene_simd4f_t s_01, s_02, s_12, k_x, k_y, k_z, inv_len;
+
+      /* the rows of four matrices, transposed, give each element
+       * of the rotation components for all of them
+       */
+      rows = graphene_simd4x4f_init (m[i].value.x, m1->value.x, m2->value.x, m3->value.x);
+      graphene_simd4x4f_transpose_in_place (&rows);
+      r[0] = rows.x; r[1] = rows.y; r[2] = rows.z;
+
+      rows = graphene_simd4x4f_init (m[i].value.y, m1->value.y, m2->value.y, m3->value.y);
+      graphene_simd4x4f_transpose_in_place (&rows);
+      r[3] = rows.x; r[4] = rows.y; r[5] = rows.z;
+
+      rows = graphene_simd4x4f_init (m[i].value.z, m1->value.z, m2->value.z, m3->value.z);
+      graphene_simd4x4f_transpose_in_place (&rows);
+      r[6] = rows.x; r[7] = rows.y; r[8] = rows.z;
+
+      /* the same terms of the matrix K as graphene_quaternion_simd_from_matrix() */
+      trace = graphene_simd4f_add (graphene_simd4f_add (r[0], r[4]), r[8]);
+      c = graphene_simd4f_sub (one, trace);
+
+      d_0 = graphene_simd4f_add (c, graphene_simd4f_add (r[0], r[0]));
+      d_1 = graphene_simd4f_add (c, graphene_simd4f_add (r[4], r[4]));
+      d_2 = graphene_simd4f_add (c, graphene_simd4f_add (r[8], r[8]));
+      d_3 = graphene_simd4f_add (one, trace);
+
+      s_01 = graphene_simd4f_add (r[1], r[3]);
+      s_02 = graphene_simd4f_add (r[2], r[6]);
+      s_12 = graphene_simd4f_add (r[5], r[7]);
+
+      k_x = graphene_simd4f_sub (r[5], r[7]);
+      k_y = graphene_simd4f_sub (r[6], r[2]);
+      k_z = graphene_simd4f_sub (r[1], r[3]);
+
+      d_max = graphene_simd4f_max (d_0, d_1);
+      d_max_hi = graphene_simd4f_max (d_2, d_3);
+      d_max = graphene_simd4f_max (d_max, d_max_hi);
+
+      /* select the row of K with the largest diagonal term in each
+       * lane; on ties, the last row wins
+       */
+      v_res.x = d_0;
+      v_res.y = s_01;
+      v_res.z = s_02;
+      v_res.w = k_x;
+
+      v_res.x = graphene_quaternion_simd_select_ge (d_1, d_max, s_01, v_res.x);
+      v_res.y = graphene_quaternion_simd_select_ge (d_1, d_max, d_1, v_res.y);
+      v_res.z = graphene_quaternion_simd_select_ge (d_1, d_max, s_12, v_res.z);
+      v_res.w = graphene_quaternion_simd_select_ge (d_1, d_max, k_y, v_res.w);
+
+      v_res.x = graphene_quaternion_simd_select_ge (d_2, d_max, s_02, v_res.x);
+      v_res.y = graphene_quaternion_simd_select_ge (d_2, d_max, s_12, v_res.y);
+      v_res.z = graphene_quaternion_simd_select_ge (d_2, d_max, d_2, v_res.z);
+      v_res.w = graphene_quaternion_simd_select_ge (d_2, d_max, k_z, v_res.w);
+
+      v_res.x = graphene_quaternion_simd_select_ge (d_3, d_max, k_x, v_res.x);
+      v_res.y = graphene_quaternion_simd_select_ge (d_3, d_max, k_y, v_res.y);
+      v_res.z = graphene_quaternion_simd_select_ge (d_3, d_max, k_z, v_res.z);
+      v_res.w = graphene_quaternion_simd_select_ge (d_3, d_max, d_3, v_res.w);
+
+      /* normalize, keeping the w ≥ 0 hemisphere */
+      inv_len = graphene_simd4f_rsqrt (quaternion_dot_soa (&v_res, &v_res));
+      inv_len = graphene_quaternion_simd_select_ge (v_res.w, zero, inv_len, graphene_simd4f_neg (inv_len));
+
+      v_res.x = graphene_simd4f_mul (v_res.x, inv_len);
+      v_res.y = graphene_simd4f_mul (v_res.y, inv_len);
+      v_res.z = graphene_simd4f_mul (v_res.z, inv_len);
+      v_res.w = graphene_simd4f_mul (v_res.w, inv_len);
+
+      quaternion_store_soa (&v_res, n, res + i);
+    }
 }
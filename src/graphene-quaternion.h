@@ -29,6 +29,8 @@
 #endif
 
 #include "graphene-types.h"
+#include "graphene-matrix.h"
+#include "graphene-vec3.h"
 #include "graphene-vec4.h"
 
 GRAPHENE_BEGIN_DECLS
@@ -131,6 +133,36 @@ void                    graphene_quaternion_slerp                       (const g
                                                                          float                        factor,
                                                                          graphene_quaternion_t       *res);
 
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_quaternion_multiply                    (const graphene_quaternion_t *a,
+                                                                         const graphene_quaternion_t *b,
+                                                                         graphene_quaternion_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_quaternion_rotate_vec3                 (const graphene_quaternion_t *q,
+                                                                         const graphene_vec3_t       *v,
+                                                                         graphene_vec3_t             *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_quaternion_rotate_vec3_array           (const graphene_quaternion_t *q,
+                                                                         unsigned int                 n_vectors,
+                                                                         const graphene_vec3_t        v[],
+                                                                         graphene_vec3_t              res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_quaternion_slerp_array                 (unsigned int                n_quaternions,
+                                                                         const graphene_quaternion_t a[],
+                                                                         const graphene_quaternion_t b[],
+                                                                         const float                 factors[],
+                                                                         graphene_quaternion_t       res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_quaternion_nlerp_array                 (unsigned int                n_quaternions,
+                                                                         const graphene_quaternion_t a[],
+                                                                         const graphene_quaternion_t b[],
+                                                                         const float                 factors[],
+                                                                         graphene_quaternion_t       res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_quaternion_init_from_matrix_array      (unsigned int                n_matrices,
+                                                                         const graphene_matrix_t     m[],
+                                                                         graphene_quaternion_t       res[]);
+
 GRAPHENE_END_DECLS
 
 #endif /* __GRAPHENE_QUATERNION_H__ */
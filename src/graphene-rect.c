@@ -189,6 +189,82 @@ graphene_rect_equal (const graphene_rect_t *a,
          graphene_size_equal (&r_a.size, &r_b.size);
 }
 
+/**
+ * graphene_rect_exact_equal:
+ * @a: a #graphene_rect_t
+ * @b: a #graphene_rect_t
+ *
+ * Checks whether the two given rectangles are exactly equal, once
+ * normalized; -0 and +0 are equal.
+ *
+ * Unlike graphene_rect_equal(), this function does not account for
+ * floating point fluctuations, so that two equal rectangles always
+ * have the same graphene_rect_hash().
+ *
+ * Returns: `true` if the rectangles are exactly equal
+ *
+ * Since: 1.4
+ */
+bool
+graphene_rect_exact_equal (const graphene_rect_t *a,
+                           const graphene_rect_t *b)
+{
+  graphene_rect_t r_a, r_b;
+
+  if (a == b)
+    return true;
+
+  if (a == NULL || b == NULL)
+    return false;
+
+  r_a = *a;
+  r_b = *b;
+
+  graphene_rect_normalize_in_place (&r_a);
+  graphene_rect_normalize_in_place (&r_b);
+
+  return r_a.origin.x == r_b.origin.x &&
+         r_a.origin.y == r_b.origin.y &&
+         r_a.size.width == r_b.size.width &&
+         r_a.size.height == r_b.size.height;
+}
+
+/**
+ * graphene_rect_hash:
+ * @r: a #graphene_rect_t
+ *
+ * Computes a hash value for the given #graphene_rect_t, suitable
+ * for using rectangles as keys in a hash table, together with
+ * graphene_rect_exact_equal().
+ *
+ * The hash value is computed on the normalized rectangle, so that
+ * rectangles with negative sizes have the same hash as their
+ * normalized counterparts; -0 and +0 have the same hash.
+ *
+ * This function cannot be used together with graphene_rect_equal(),
+ * as rectangles that are only nearly equal may have different hash
+ * values.
+ *
+ * Returns: the hash value of the rectangle
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_rect_hash (const graphene_rect_t *r)
+{
+  graphene_rect_t tmp = *r;
+  float v[4];
+
+  graphene_rect_normalize_in_place (&tmp);
+
+  v[0] = tmp.origin.x;
+  v[1] = tmp.origin.y;
+  v[2] = tmp.size.width;
+  v[3] = tmp.size.height;
+
+  return graphene_hash_floats (v, 4);
+}
+
 /**
  * graphene_rect_normalize:
  * @r: a #graphene_rect_t
@@ -503,7 +579,7 @@ graphene_rect_intersection (const graphene_rect_t *a,
   x_1 = MAX (ra.origin.x, rb.origin.x);
   y_1 = MAX (ra.origin.y, rb.origin.y);
   x_2 = MIN (ra.origin.x + ra.size.width, rb.origin.x + rb.size.width);
-  y_2 = MIN (ra.origin.y + ra.size.height, rb.origin.x + rb.size.height);
+  y_2 = MIN (ra.origin.y + ra.size.height, rb.origin.y + rb.size.height);
 
   if (x_1 >= x_2 || y_1 >= y_2)
     {
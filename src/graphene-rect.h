@@ -92,6 +92,11 @@ graphene_rect_t *       graphene_rect_init_from_rect    (graphene_rect_t       *
 GRAPHENE_AVAILABLE_IN_1_0
 bool                    graphene_rect_equal             (const graphene_rect_t *a,
                                                          const graphene_rect_t *b);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                    graphene_rect_exact_equal       (const graphene_rect_t *a,
+                                                         const graphene_rect_t *b);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int            graphene_rect_hash              (const graphene_rect_t *r);
 GRAPHENE_AVAILABLE_IN_1_0
 graphene_rect_t *       graphene_rect_normalize         (graphene_rect_t       *r);
 GRAPHENE_AVAILABLE_IN_1_4
@@ -0,0 +1,364 @@
+/* graphene-skin.c: Vertex skinning
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-skin
+ * @Title: Skinning
+ * @Short_Description: Deformation of vertices by a skeleton
+ *
+ * Skinning deforms the vertices of a mesh using the bones of a skeleton;
+ * each vertex is influenced by up to %GRAPHENE_SKIN_MAX_INFLUENCES bones,
+ * each one with its own weight.
+ *
+ * The vertex attributes are described by a #graphene_skin_vertices_t,
+ * which can point to separate or interleaved vertex buffers.
+ *
+ * graphene_skin_vertices_blend_matrices() implements linear blend
+ * skinning: the matrices of the bones influencing a vertex are blended
+ * together using the weights of the vertex, and the resulting matrix is
+ * used to transform the position and the normal of the vertex. Each row
+ * of the matrix is blended in a single SIMD operation, and the bones with
+ * a weight of zero are skipped. graphene_skin_vertices_blend_matrices3x4()
+ * does the same using a palette of #graphene_matrix3x4_t, which only
+ * blends three rows for each bone.
+ *
+ * graphene_skin_vertices_blend_dual_quaternions() implements dual
+ * quaternion skinning: the bones are described by rigid transformations,
+ * which are blended and normalized for each vertex. The result does not
+ * lose volume around twisting joints, unlike linear blend skinning, and
+ * the palette of bones is half the size of a palette of matrices.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-skin.h"
+
+#include "graphene-dual-quaternion.h"
+#include "graphene-matrix.h"
+#include "graphene-matrix3x4.h"
+#include "graphene-matrix-private.h"
+#include "graphene-quaternion-private.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+static inline const void *
+vertex_attribute (const void   *base,
+                  unsigned int  stride,
+                  unsigned int  index_)
+{
+  return (const char *) base + (size_t) stride * index_;
+}
+
+static inline void *
+vertex_attribute_mut (void         *base,
+                      unsigned int  stride,
+                      unsigned int  index_)
+{
+  return (char *) base + (size_t) stride * index_;
+}
+
+static inline graphene_simd4f_t
+vertex_load3 (const float *v,
+              float        w)
+{
+  return graphene_simd4f_init (v[0], v[1], v[2], w);
+}
+
+static inline graphene_simd4f_t
+vertex_normalize3 (const graphene_simd4f_t n)
+{
+  if (graphene_simd4f_get_x (graphene_simd4f_dot3 (n, n)) > 0.f)
+    return graphene_simd4f_normalize3 (n);
+
+  return n;
+}
+
+/*< private >
+ * skin_vertices_apply:
+ * @v: a #graphene_skin_vertices_t
+ * @i: the index of the vertex
+ * @m: the matrix used to transform the vertex
+ *
+ * Transforms the position and the normal of the given vertex.
+ */
+static inline void
+skin_vertices_apply (const graphene_skin_vertices_t *v,
+                     unsigned int                    i,
+                     const graphene_simd4x4f_t      *m)
+{
+  graphene_simd4f_t p;
+
+  p = vertex_load3 (vertex_attribute (v->positions, v->positions_stride, i), 1.f);
+  graphene_simd4x4f_point3_mul (m, &p, &p);
+  graphene_simd4f_dup_3f (p, vertex_attribute_mut (v->skinned_positions, v->skinned_positions_stride, i));
+
+  if (v->normals != NULL && v->skinned_normals != NULL)
+    {
+      graphene_simd4f_t n;
+
+      n = vertex_load3 (vertex_attribute (v->normals, v->normals_stride, i), 0.f);
+      graphene_simd4x4f_vec3_mul (m, &n, &n);
+      n = vertex_normalize3 (n);
+      graphene_simd4f_dup_3f (n, vertex_attribute_mut (v->skinned_normals, v->skinned_normals_stride, i));
+    }
+}
+
+static inline void
+skin_vertices_apply3x4 (const graphene_skin_vertices_t *v,
+                        unsigned int                    i,
+                        const graphene_simd4f_t         x,
+                        const graphene_simd4f_t         y,
+                        const graphene_simd4f_t         z)
+{
+  graphene_simd4f_t p;
+
+  p = vertex_load3 (vertex_attribute (v->positions, v->positions_stride, i), 1.f);
+  p = graphene_matrix3x4_transform_internal (x, y, z, p);
+  graphene_simd4f_dup_3f (p, vertex_attribute_mut (v->skinned_positions, v->skinned_positions_stride, i));
+
+  if (v->normals != NULL && v->skinned_normals != NULL)
+    {
+      graphene_simd4f_t n;
+
+      n = vertex_load3 (vertex_attribute (v->normals, v->normals_stride, i), 0.f);
+      n = graphene_matrix3x4_transform_internal (x, y, z, n);
+      n = vertex_normalize3 (n);
+      graphene_simd4f_dup_3f (n, vertex_attribute_mut (v->skinned_normals, v->skinned_normals_stride, i));
+    }
+}
+
+/**
+ * graphene_skin_vertices_blend_matrices:
+ * @v: a #graphene_skin_vertices_t
+ * @n_bones: the number of bones
+ * @bones: (array length=n_bones): the matrices of the bones, each one
+ *   transforming from the bind pose to the current pose
+ *
+ * Skins the vertices described by @v using linear blend skinning.
+ *
+ * Each skinned position is the position of the vertex transformed by
+ * the weighted sum of the matrices of the bones influencing it; each
+ * skinned normal is transformed by the same matrix, without the
+ * translation, and normalized. The normals are only transformed if
+ * both the @normals and @skinned_normals fields of @v are set.
+ *
+ * The bone matrices are expected to be affine transformations; for
+ * transformations with a non-uniform scale the normals should be
+ * transformed with the inverse transpose of the bone matrices instead.
+ *
+ * Indices of bones outside of the @bones array are ignored.
+ *
+ * Since: 1.4
+ */
+void
+graphene_skin_vertices_blend_matrices (const graphene_skin_vertices_t *v,
+                                       unsigned int                    n_bones,
+                                       const graphene_matrix_t         bones[])
+{
+  unsigned int i, j;
+
+  for (i = 0; i < v->n_vertices; i++)
+    {
+      const unsigned short *indices = vertex_attribute (v->bones, v->bones_stride, i);
+      const float *weights = vertex_attribute (v->weights, v->weights_stride, i);
+      graphene_simd4x4f_t m;
+
+      /* a vertex influenced by a single bone does not need blending */
+      if (weights[0] == 1.f && indices[0] < n_bones)
+        {
+          skin_vertices_apply (v, i, &bones[indices[0]].value);
+          continue;
+        }
+
+      m.x = m.y = m.z = m.w = graphene_simd4f_splat (0.f);
+
+      for (j = 0; j < GRAPHENE_SKIN_MAX_INFLUENCES; j++)
+        {
+          const graphene_simd4x4f_t *bone;
+          graphene_simd4f_t w;
+
+          if (weights[j] == 0.f || indices[j] >= n_bones)
+            continue;
+
+          bone = &bones[indices[j]].value;
+          w = graphene_simd4f_splat (weights[j]);
+
+          m.x = graphene_simd4f_madd (bone->x, w, m.x);
+          m.y = graphene_simd4f_madd (bone->y, w, m.y);
+          m.z = graphene_simd4f_madd (bone->z, w, m.z);
+          m.w = graphene_simd4f_madd (bone->w, w, m.w);
+        }
+
+      skin_vertices_apply (v, i, &m);
+    }
+}
+
+/**
+ * graphene_skin_vertices_blend_matrices3x4:
+ * @v: a #graphene_skin_vertices_t
+ * @n_bones: the number of bones
+ * @bones: (array length=n_bones): the affine matrices of the bones, each
+ *   one transforming from the bind pose to the current pose
+ *
+ * Skins the vertices described by @v using linear blend skinning, like
+ * graphene_skin_vertices_blend_matrices(), using a palette of compact
+ * affine matrices.
+ *
+ * Since: 1.4
+ */
+void
+graphene_skin_vertices_blend_matrices3x4 (const graphene_skin_vertices_t *v,
+                                          unsigned int                    n_bones,
+                                          const graphene_matrix3x4_t      bones[])
+{
+  unsigned int i, j;
+
+  for (i = 0; i < v->n_vertices; i++)
+    {
+      const unsigned short *indices = vertex_attribute (v->bones, v->bones_stride, i);
+      const float *weights = vertex_attribute (v->weights, v->weights_stride, i);
+      graphene_simd4f_t x, y, z;
+
+      /* a vertex influenced by a single bone does not need blending */
+      if (weights[0] == 1.f && indices[0] < n_bones)
+        {
+          const graphene_matrix3x4_t *bone = &bones[indices[0]];
+
+          skin_vertices_apply3x4 (v, i, bone->x, bone->y, bone->z);
+          continue;
+        }
+
+      x = y = z = graphene_simd4f_splat (0.f);
+
+      for (j = 0; j < GRAPHENE_SKIN_MAX_INFLUENCES; j++)
+        {
+          const graphene_matrix3x4_t *bone;
+          graphene_simd4f_t w;
+
+          if (weights[j] == 0.f || indices[j] >= n_bones)
+            continue;
+
+          bone = &bones[indices[j]];
+          w = graphene_simd4f_splat (weights[j]);
+
+          x = graphene_simd4f_madd (bone->x, w, x);
+          y = graphene_simd4f_madd (bone->y, w, y);
+          z = graphene_simd4f_madd (bone->z, w, z);
+        }
+
+      skin_vertices_apply3x4 (v, i, x, y, z);
+    }
+}
+
+/**
+ * graphene_skin_vertices_blend_dual_quaternions:
+ * @v: a #graphene_skin_vertices_t
+ * @n_bones: the number of bones
+ * @bones: (array length=n_bones): the unit dual quaternions of the bones,
+ *   each one transforming from the bind pose to the current pose
+ *
+ * Skins the vertices described by @v using dual quaternion skinning.
+ *
+ * The dual quaternions of the bones influencing each vertex are blended
+ * like graphene_dual_quaternion_blend() does, and the result is used to
+ * transform the position and the normal of the vertex. The normals are
+ * only transformed if both the @normals and @skinned_normals fields of
+ * @v are set.
+ *
+ * Indices of bones outside of the @bones array are ignored.
+ *
+ * Since: 1.4
+ */
+void
+graphene_skin_vertices_blend_dual_quaternions (const graphene_skin_vertices_t   *v,
+                                               unsigned int                      n_bones,
+                                               const graphene_dual_quaternion_t  bones[])
+{
+  unsigned int i, j;
+
+  for (i = 0; i < v->n_vertices; i++)
+    {
+      const unsigned short *indices = vertex_attribute (v->bones, v->bones_stride, i);
+      const float *weights = vertex_attribute (v->weights, v->weights_stride, i);
+      graphene_simd4f_t r, d, r_w, t, p;
+      graphene_simd4f_t pivot = graphene_simd4f_splat (0.f);
+      bool has_pivot = false;
+
+      r = d = graphene_simd4f_splat (0.f);
+
+      for (j = 0; j < GRAPHENE_SKIN_MAX_INFLUENCES; j++)
+        {
+          graphene_simd4f_t b_r, w;
+          float sign = 1.f;
+
+          if (weights[j] == 0.f || indices[j] >= n_bones)
+            continue;
+
+          b_r = graphene_quaternion_load (&bones[indices[j]].real);
+
+          /* keep every rotation on the same hemisphere as the first one */
+          if (!has_pivot)
+            {
+              pivot = b_r;
+              has_pivot = true;
+            }
+          else if (graphene_quaternion_simd_dot (b_r, pivot) < 0.f)
+            sign = -1.f;
+
+          w = graphene_simd4f_splat (weights[j] * sign);
+          r = graphene_simd4f_madd (b_r, w, r);
+          d = graphene_simd4f_madd (graphene_quaternion_load (&bones[indices[j]].dual), w, d);
+        }
+
+      if (!has_pivot)
+        {
+          r = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+        }
+      else
+        {
+          /* the translation does not need an orthogonal dual part, so
+           * scaling both parts by the inverse length is enough
+           */
+          graphene_simd4f_t len = graphene_simd4f_length4 (r);
+
+          r = graphene_simd4f_div (r, len);
+          d = graphene_simd4f_div (d, len);
+        }
+
+      r_w = graphene_simd4f_splat_w (r);
+      t = graphene_dual_quaternion_simd_translation (r, d);
+
+      p = vertex_load3 (vertex_attribute (v->positions, v->positions_stride, i), 0.f);
+      p = graphene_simd4f_add (graphene_quaternion_simd_rotate (r, r_w, p), t);
+      graphene_simd4f_dup_3f (p, vertex_attribute_mut (v->skinned_positions, v->skinned_positions_stride, i));
+
+      if (v->normals != NULL && v->skinned_normals != NULL)
+        {
+          graphene_simd4f_t n;
+
+          n = vertex_load3 (vertex_attribute (v->normals, v->normals_stride, i), 0.f);
+          n = graphene_quaternion_simd_rotate (r, r_w, n);
+          graphene_simd4f_dup_3f (n, vertex_attribute_mut (v->skinned_normals, v->skinned_normals_stride, i));
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/* graphene-skin.h: Vertex skinning
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_SKIN_H__
+#define __GRAPHENE_SKIN_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-dual-quaternion.h"
+#include "graphene-matrix.h"
+#include "graphene-matrix3x4.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * GRAPHENE_SKIN_MAX_INFLUENCES:
+ *
+ * The number of bones influencing each vertex.
+ *
+ * Since: 1.4
+ */
+#define GRAPHENE_SKIN_MAX_INFLUENCES    4
+
+/**
+ * graphene_skin_vertices_t:
+ * @n_vertices: the number of vertices
+ * @positions: the position of the first vertex, as three floats
+ * @positions_stride: the distance in bytes between two positions
+ * @normals: (nullable): the normal of the first vertex, as three floats
+ * @normals_stride: the distance in bytes between two normals
+ * @bones: the indices of the bones influencing the first vertex, as
+ *   %GRAPHENE_SKIN_MAX_INFLUENCES unsigned shorts
+ * @bones_stride: the distance in bytes between two sets of indices
+ * @weights: the weights of the bones influencing the first vertex, as
+ *   %GRAPHENE_SKIN_MAX_INFLUENCES floats
+ * @weights_stride: the distance in bytes between two sets of weights
+ * @skinned_positions: return location for the skinned position of the
+ *   first vertex, as three floats
+ * @skinned_positions_stride: the distance in bytes between two skinned
+ *   positions
+ * @skinned_normals: (nullable): return location for the skinned normal
+ *   of the first vertex, as three floats
+ * @skinned_normals_stride: the distance in bytes between two skinned
+ *   normals
+ *
+ * A description of the vertex buffers used by the skinning functions.
+ *
+ * Each attribute is read from, or written to, its own buffer, using its
+ * own stride; this allows using both separate and interleaved buffers,
+ * as long as each attribute is stored at an offset aligned to a float.
+ *
+ * The weights of each vertex should add up to 1; the weights of unused
+ * influences should be set to 0.
+ *
+ * Since: 1.4
+ */
+struct _graphene_skin_vertices_t
+{
+  unsigned int n_vertices;
+
+  const float *positions;
+  unsigned int positions_stride;
+
+  const float *normals;
+  unsigned int normals_stride;
+
+  const unsigned short *bones;
+  unsigned int bones_stride;
+
+  const float *weights;
+  unsigned int weights_stride;
+
+  float *skinned_positions;
+  unsigned int skinned_positions_stride;
+
+  float *skinned_normals;
+  unsigned int skinned_normals_stride;
+};
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_skin_vertices_blend_matrices           (const graphene_skin_vertices_t *v,
+                                                                         unsigned int                    n_bones,
+                                                                         const graphene_matrix_t         bones[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_skin_vertices_blend_matrices3x4        (const graphene_skin_vertices_t *v,
+                                                                         unsigned int                    n_bones,
+                                                                         const graphene_matrix3x4_t      bones[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                    graphene_skin_vertices_blend_dual_quaternions   (const graphene_skin_vertices_t   *v,
+                                                                         unsigned int                      n_bones,
+                                                                         const graphene_dual_quaternion_t  bones[]);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_SKIN_H__ */
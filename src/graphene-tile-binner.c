@@ -0,0 +1,614 @@
+/* graphene-tile-binner.c: Screen space tile binning
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-tile-binner
+ * @Title: Tile binner
+ * @Short_Description: Screen space binning of rectangles and quads
+ *
+ * #graphene_tile_binner_t divides an area into a grid of fixed size tiles,
+ * and assigns each rectangle or quadrilateral added to it to the tiles
+ * it overlaps, as commonly done by tile based renderers.
+ *
+ * Each primitive is identified by the index it was added with; the list
+ * of indices for a tile is stored contiguously, and it is always sorted
+ * in the order in which the primitives were added.
+ *
+ * Rectangles are assigned to every tile their bounds overlap. Convex
+ * quadrilaterals are additionally tested against the tiles using their
+ * edges, which avoids binning a rotated quad into the tiles lying in the
+ * corners of its bounds. The test is conservative: a primitive may be
+ * assigned to a tile it only touches, but never skips a tile it covers.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-tile-binner.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-point.h"
+#include "graphene-quad.h"
+#include "graphene-rect.h"
+#include "graphene-simd4f.h"
+
+#include <math.h>
+#include <string.h>
+
+typedef struct {
+  /* first column, first row, last column, last row */
+  int tiles[4];
+
+  /* offset of the edge equations in the edges array, or -1 */
+  int edges;
+} tile_item_t;
+
+/**
+ * graphene_tile_binner_t:
+ *
+ * An opaque structure used to bin rectangles and quadrilaterals into
+ * screen space tiles.
+ *
+ * Since: 1.4
+ */
+struct _graphene_tile_binner_t
+{
+  graphene_rect_t area;
+  float tile_width;
+  float tile_height;
+  unsigned int n_columns;
+  unsigned int n_rows;
+
+  tile_item_t *items;
+  unsigned int n_items;
+  unsigned int items_size;
+
+  /* the outward normals and offsets of the four edges of each
+   * convex quad, stored as { nx[4], ny[4], c[4] }
+   */
+  float *edges;
+  unsigned int n_edges;
+  unsigned int edges_size;
+
+  /* per-tile ranges inside the indices array */
+  unsigned int *offsets;
+  unsigned int offsets_size;
+  unsigned int *indices;
+  unsigned int indices_size;
+
+  bool dirty;
+};
+
+static void *
+grow_array (void         *data,
+            unsigned int *size,
+            unsigned int  needed,
+            size_t        element_size)
+{
+  unsigned int new_size;
+  void *res;
+
+  if (needed <= *size)
+    return data;
+
+  new_size = *size > 0 ? *size : 16;
+  while (new_size < needed)
+    new_size *= 2;
+
+  /* graphene_aligned_alloc() aborts if the allocation fails, unlike
+   * realloc(), which would leave us with a NULL array
+   */
+  res = graphene_aligned_alloc (element_size, new_size, 16);
+  if (*size > 0)
+    memcpy (res, data, *size * element_size);
+
+  graphene_aligned_free (data);
+  *size = new_size;
+
+  return res;
+}
+
+/**
+ * graphene_tile_binner_alloc: (constructor)
+ *
+ * Allocates a new #graphene_tile_binner_t.
+ *
+ * The returned binner has no tiles; use graphene_tile_binner_init()
+ * to set up the tile grid.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_tile_binner_t.
+ *   Use graphene_tile_binner_free() to free the resources allocated by
+ *   this function
+ *
+ * Since: 1.4
+ */
+graphene_tile_binner_t *
+graphene_tile_binner_alloc (void)
+{
+  return calloc (1, sizeof (graphene_tile_binner_t));
+}
+
+/**
+ * graphene_tile_binner_free:
+ * @b: a #graphene_tile_binner_t
+ *
+ * Frees the resources allocated by graphene_tile_binner_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_tile_binner_free (graphene_tile_binner_t *b)
+{
+  if (b == NULL)
+    return;
+
+  graphene_aligned_free (b->items);
+  graphene_aligned_free (b->edges);
+  graphene_aligned_free (b->offsets);
+  graphene_aligned_free (b->indices);
+  free (b);
+}
+
+/**
+ * graphene_tile_binner_init:
+ * @b: the #graphene_tile_binner_t to initialize
+ * @area: the area covered by the tiles
+ * @tile_width: the width of each tile
+ * @tile_height: the height of each tile
+ *
+ * Initializes a #graphene_tile_binner_t with a grid of tiles covering
+ * the given @area, and removes all the primitives previously added.
+ *
+ * The tiles on the right and bottom edges of the grid may extend
+ * past the @area, if its size is not a multiple of the tile size.
+ *
+ * The memory used by the binner is retained, so that re-initializing
+ * it on every frame does not require new allocations.
+ *
+ * Returns: (transfer none): the initialized #graphene_tile_binner_t
+ *
+ * Since: 1.4
+ */
+graphene_tile_binner_t *
+graphene_tile_binner_init (graphene_tile_binner_t *b,
+                           const graphene_rect_t  *area,
+                           float                   tile_width,
+                           float                   tile_height)
+{
+  graphene_rect_normalize_r (area, &b->area);
+
+  b->tile_width = tile_width;
+  b->tile_height = tile_height;
+
+  if (tile_width > 0.f && tile_height > 0.f)
+    {
+      b->n_columns = (unsigned int) ceilf (b->area.size.width / tile_width);
+      b->n_rows = (unsigned int) ceilf (b->area.size.height / tile_height);
+    }
+  else
+    {
+      b->n_columns = 0;
+      b->n_rows = 0;
+    }
+
+  b->n_items = 0;
+  b->n_edges = 0;
+  b->dirty = true;
+
+  return b;
+}
+
+/*< private >
+ * tile_binner_add_item:
+ * @b: a #graphene_tile_binner_t
+ * @bounds: the bounds of the primitive, as { min_x, min_y, max_x, max_y }
+ * @edges: the offset of the edge equations of the primitive, or -1
+ *
+ * Adds a new item, computing the range of tiles covered by @bounds.
+ *
+ * Returns: the index of the item
+ */
+static unsigned int
+tile_binner_add_item (graphene_tile_binner_t  *b,
+                      const graphene_simd4f_t  bounds,
+                      int                      edges)
+{
+  const graphene_simd4f_t origin =
+    graphene_simd4f_init (b->area.origin.x, b->area.origin.y,
+                          b->area.origin.x, b->area.origin.y);
+  const graphene_simd4f_t scale =
+    graphene_simd4f_init (1.f / b->tile_width, 1.f / b->tile_height,
+                          1.f / b->tile_width, 1.f / b->tile_height);
+  graphene_simd4f_t v;
+  tile_item_t *item;
+  float t[4];
+
+  b->items = grow_array (b->items, &b->items_size, b->n_items + 1, sizeof (tile_item_t));
+  b->dirty = true;
+
+  item = &b->items[b->n_items];
+  item->edges = edges;
+
+  /* an empty range, for primitives that do not overlap any tile */
+  item->tiles[0] = item->tiles[1] = 0;
+  item->tiles[2] = item->tiles[3] = -1;
+
+  /* bounds in tile units */
+  v = graphene_simd4f_mul (graphene_simd4f_sub (bounds, origin), scale);
+  graphene_simd4f_dup_4f (v, t);
+
+  if (b->n_columns > 0 &&
+      t[0] < t[2] && t[1] < t[3] &&
+      t[2] > 0.f && t[3] > 0.f &&
+      t[0] < (float) b->n_columns && t[1] < (float) b->n_rows)
+    {
+      item->tiles[0] = (int) floorf (MAX (t[0], 0.f));
+      item->tiles[1] = (int) floorf (MAX (t[1], 0.f));
+      item->tiles[2] = (int) ceilf (MIN (t[2], (float) b->n_columns)) - 1;
+      item->tiles[3] = (int) ceilf (MIN (t[3], (float) b->n_rows)) - 1;
+    }
+
+  return b->n_items++;
+}
+
+/**
+ * graphene_tile_binner_add_rect:
+ * @b: a #graphene_tile_binner_t
+ * @r: a #graphene_rect_t
+ *
+ * Adds the rectangle @r to the binner.
+ *
+ * Returns: the index of the rectangle
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_tile_binner_add_rect (graphene_tile_binner_t *b,
+                               const graphene_rect_t  *r)
+{
+  graphene_simd4f_t p_0, p_1;
+
+  p_0 = graphene_simd4f_init (r->origin.x, r->origin.y, 0.f, 0.f);
+  p_1 = graphene_simd4f_add (p_0, graphene_simd4f_init (r->size.width, r->size.height, 0.f, 0.f));
+
+  /* normalize, and pack as { min_x, min_y, max_x, max_y } */
+  return tile_binner_add_item (b,
+                               graphene_simd4f_merge_low (graphene_simd4f_min (p_0, p_1),
+                                                          graphene_simd4f_max (p_0, p_1)),
+                               -1);
+}
+
+/*< private >
+ * quad_compute_edges:
+ * @q: a #graphene_quad_t
+ * @edges: (out) (array fixed-size=12): return location for the edge equations
+ *
+ * Computes the outward normals and offsets of the edges of @q.
+ *
+ * Returns: `true` if the quad is convex, and the edge equations are
+ *   valid; `false` otherwise
+ */
+static bool
+quad_compute_edges (const graphene_quad_t *q,
+                    float                  edges[12])
+{
+  graphene_point_t p[4], e[4];
+  float sign, turn, area = 0.f;
+  bool has_positive = false, has_negative = false;
+  int i;
+
+  for (i = 0; i < 4; i++)
+    p[i] = *graphene_quad_get_point (q, i);
+
+  for (i = 0; i < 4; i++)
+    {
+      e[i].x = p[(i + 1) % 4].x - p[i].x;
+      e[i].y = p[(i + 1) % 4].y - p[i].y;
+    }
+
+  /* a quad is convex if all its corners turn in the same direction */
+  for (i = 0; i < 4; i++)
+    {
+      turn = e[i].x * e[(i + 1) % 4].y - e[i].y * e[(i + 1) % 4].x;
+      if (turn > 0.f)
+        has_positive = true;
+      else if (turn < 0.f)
+        has_negative = true;
+
+      area += turn;
+    }
+
+  if (has_positive == has_negative)
+    return false;
+
+  sign = area > 0.f ? 1.f : -1.f;
+
+  for (i = 0; i < 4; i++)
+    {
+      edges[i] = sign * e[i].y;
+      edges[i + 4] = -sign * e[i].x;
+      edges[i + 8] = edges[i] * p[i].x + edges[i + 4] * p[i].y;
+    }
+
+  return true;
+}
+
+/**
+ * graphene_tile_binner_add_quad:
+ * @b: a #graphene_tile_binner_t
+ * @q: a #graphene_quad_t
+ *
+ * Adds the quadrilateral @q to the binner.
+ *
+ * If @q is convex, it is only assigned to the tiles that are not
+ * completely outside of one of its edges; otherwise, it is assigned
+ * to all the tiles overlapping its bounds.
+ *
+ * Returns: the index of the quadrilateral
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_tile_binner_add_quad (graphene_tile_binner_t *b,
+                               const graphene_quad_t  *q)
+{
+  const graphene_point_t *p[4];
+  graphene_simd4f_t vx, vy;
+  int edges = -1;
+  int i;
+
+  for (i = 0; i < 4; i++)
+    p[i] = graphene_quad_get_point (q, i);
+
+  vx = graphene_simd4f_init (p[0]->x, p[1]->x, p[2]->x, p[3]->x);
+  vy = graphene_simd4f_init (p[0]->y, p[1]->y, p[2]->y, p[3]->y);
+
+  b->edges = grow_array (b->edges, &b->edges_size, b->n_edges + 12, sizeof (float));
+  if (quad_compute_edges (q, b->edges + b->n_edges))
+    {
+      edges = (int) b->n_edges;
+      b->n_edges += 12;
+    }
+
+  return tile_binner_add_item (b,
+                               graphene_simd4f_init (graphene_simd4f_get_x (graphene_simd4f_min_val (vx)),
+                                                     graphene_simd4f_get_x (graphene_simd4f_min_val (vy)),
+                                                     graphene_simd4f_get_x (graphene_simd4f_max_val (vx)),
+                                                     graphene_simd4f_get_x (graphene_simd4f_max_val (vy))),
+                               edges);
+}
+
+/**
+ * graphene_tile_binner_add_rects:
+ * @b: a #graphene_tile_binner_t
+ * @n_rects: the number of rectangles in @rects
+ * @rects: (array length=n_rects): an array of #graphene_rect_t
+ *
+ * Adds an array of rectangles to the binner; the rectangles will
+ * have consecutive indices, starting from the value returned by
+ * graphene_tile_binner_get_n_items() before the call.
+ *
+ * Since: 1.4
+ */
+void
+graphene_tile_binner_add_rects (graphene_tile_binner_t *b,
+                                unsigned int            n_rects,
+                                const graphene_rect_t   rects[])
+{
+  unsigned int i;
+
+  b->items = grow_array (b->items, &b->items_size, b->n_items + n_rects, sizeof (tile_item_t));
+
+  for (i = 0; i < n_rects; i++)
+    graphene_tile_binner_add_rect (b, &rects[i]);
+}
+
+/**
+ * graphene_tile_binner_add_quads:
+ * @b: a #graphene_tile_binner_t
+ * @n_quads: the number of quadrilaterals in @quads
+ * @quads: (array length=n_quads): an array of #graphene_quad_t
+ *
+ * Adds an array of quadrilaterals to the binner; the quadrilaterals
+ * will have consecutive indices, starting from the value returned by
+ * graphene_tile_binner_get_n_items() before the call.
+ *
+ * Since: 1.4
+ */
+void
+graphene_tile_binner_add_quads (graphene_tile_binner_t *b,
+                                unsigned int            n_quads,
+                                const graphene_quad_t   quads[])
+{
+  unsigned int i;
+
+  b->items = grow_array (b->items, &b->items_size, b->n_items + n_quads, sizeof (tile_item_t));
+  b->edges = grow_array (b->edges, &b->edges_size, b->n_edges + n_quads * 12, sizeof (float));
+
+  for (i = 0; i < n_quads; i++)
+    graphene_tile_binner_add_quad (b, &quads[i]);
+}
+
+/**
+ * graphene_tile_binner_get_grid_size:
+ * @b: a #graphene_tile_binner_t
+ * @n_columns: (out) (optional): return location for the number of columns
+ * @n_rows: (out) (optional): return location for the number of rows
+ *
+ * Retrieves the size of the tile grid.
+ *
+ * Since: 1.4
+ */
+void
+graphene_tile_binner_get_grid_size (const graphene_tile_binner_t *b,
+                                    unsigned int                 *n_columns,
+                                    unsigned int                 *n_rows)
+{
+  if (n_columns != NULL)
+    *n_columns = b->n_columns;
+
+  if (n_rows != NULL)
+    *n_rows = b->n_rows;
+}
+
+/**
+ * graphene_tile_binner_get_n_items:
+ * @b: a #graphene_tile_binner_t
+ *
+ * Retrieves the number of primitives added to the binner since
+ * the last call to graphene_tile_binner_init().
+ *
+ * Returns: the number of primitives
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_tile_binner_get_n_items (const graphene_tile_binner_t *b)
+{
+  return b->n_items;
+}
+
+static inline bool
+tile_item_overlaps_tile (const graphene_tile_binner_t *b,
+                         const tile_item_t            *item,
+                         int                           column,
+                         int                           row)
+{
+  const float *edges;
+  graphene_simd4f_t nx, ny, x_0, x_1, y_0, y_1, d;
+  float min_x, min_y;
+
+  if (item->edges < 0)
+    return true;
+
+  edges = b->edges + item->edges;
+  nx = graphene_simd4f_init_4f (edges);
+  ny = graphene_simd4f_init_4f (edges + 4);
+
+  min_x = b->area.origin.x + column * b->tile_width;
+  min_y = b->area.origin.y + row * b->tile_height;
+
+  x_0 = graphene_simd4f_mul (nx, graphene_simd4f_splat (min_x));
+  x_1 = graphene_simd4f_mul (nx, graphene_simd4f_splat (min_x + b->tile_width));
+  y_0 = graphene_simd4f_mul (ny, graphene_simd4f_splat (min_y));
+  y_1 = graphene_simd4f_mul (ny, graphene_simd4f_splat (min_y + b->tile_height));
+
+  /* the distance of the tile corner that is the furthest inside of
+   * each edge; if any of them is positive, the tile is completely
+   * outside of the quad
+   */
+  d = graphene_simd4f_sub (graphene_simd4f_add (graphene_simd4f_min (x_0, x_1),
+                                                graphene_simd4f_min (y_0, y_1)),
+                           graphene_simd4f_init_4f (edges + 8));
+
+  return graphene_simd4f_get_x (graphene_simd4f_max_val (d)) <= 0.f;
+}
+
+static void
+graphene_tile_binner_build (graphene_tile_binner_t *b)
+{
+  unsigned int n_tiles = b->n_columns * b->n_rows;
+  unsigned int i, t;
+  int row, column;
+
+  b->offsets = grow_array (b->offsets, &b->offsets_size, n_tiles + 1, sizeof (unsigned int));
+  memset (b->offsets, 0, (n_tiles + 1) * sizeof (unsigned int));
+
+  /* count the items in each tile */
+  for (i = 0; i < b->n_items; i++)
+    {
+      const tile_item_t *item = &b->items[i];
+
+      for (row = item->tiles[1]; row <= item->tiles[3]; row++)
+        for (column = item->tiles[0]; column <= item->tiles[2]; column++)
+          if (tile_item_overlaps_tile (b, item, column, row))
+            b->offsets[row * b->n_columns + column] += 1;
+    }
+
+  /* the offsets now point at the end of each tile's range */
+  for (t = 1; t <= n_tiles; t++)
+    b->offsets[t] += b->offsets[t - 1];
+
+  b->indices = grow_array (b->indices, &b->indices_size, b->offsets[n_tiles], sizeof (unsigned int));
+
+  /* fill the tiles back to front, so that each range ends up sorted
+   * by index, and its offset ends up pointing at its beginning
+   */
+  for (i = b->n_items; i > 0; i--)
+    {
+      const tile_item_t *item = &b->items[i - 1];
+
+      for (row = item->tiles[1]; row <= item->tiles[3]; row++)
+        for (column = item->tiles[0]; column <= item->tiles[2]; column++)
+          if (tile_item_overlaps_tile (b, item, column, row))
+            {
+              t = row * b->n_columns + column;
+              b->offsets[t] -= 1;
+              b->indices[b->offsets[t]] = i - 1;
+            }
+    }
+
+  b->dirty = false;
+}
+
+/**
+ * graphene_tile_binner_get_tile:
+ * @b: a #graphene_tile_binner_t
+ * @column: the column of the tile
+ * @row: the row of the tile
+ * @n_indices: (out): return location for the number of indices
+ *
+ * Retrieves the indices of the primitives assigned to the tile at
+ * the given @column and @row, sorted in the order in which they
+ * were added to the binner.
+ *
+ * The per-tile lists are built the first time this function is
+ * called after adding new primitives.
+ *
+ * Returns: (array length=n_indices) (transfer none): the indices of
+ *   the primitives overlapping the tile. The returned array is owned
+ *   by the binner, and it is valid until the next change
+ *
+ * Since: 1.4
+ */
+const unsigned int *
+graphene_tile_binner_get_tile (graphene_tile_binner_t *b,
+                               unsigned int            column,
+                               unsigned int            row,
+                               unsigned int           *n_indices)
+{
+  unsigned int t;
+
+  if (column >= b->n_columns || row >= b->n_rows)
+    {
+      *n_indices = 0;
+      return NULL;
+    }
+
+  if (b->dirty)
+    graphene_tile_binner_build (b);
+
+  t = row * b->n_columns + column;
+  *n_indices = b->offsets[t + 1] - b->offsets[t];
+
+  return b->indices + b->offsets[t];
+}
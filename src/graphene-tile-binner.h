@@ -0,0 +1,77 @@
+/* graphene-tile-binner.h: Screen space tile binning
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_TILE_BINNER_H__
+#define __GRAPHENE_TILE_BINNER_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-quad.h"
+#include "graphene-rect.h"
+
+GRAPHENE_BEGIN_DECLS
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_tile_binner_t *        graphene_tile_binner_alloc              (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_tile_binner_free               (graphene_tile_binner_t *b);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_tile_binner_t *        graphene_tile_binner_init               (graphene_tile_binner_t *b,
+                                                                         const graphene_rect_t  *area,
+                                                                         float                   tile_width,
+                                                                         float                   tile_height);
+
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int                    graphene_tile_binner_add_rect           (graphene_tile_binner_t *b,
+                                                                         const graphene_rect_t  *r);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int                    graphene_tile_binner_add_quad           (graphene_tile_binner_t *b,
+                                                                         const graphene_quad_t  *q);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_tile_binner_add_rects          (graphene_tile_binner_t *b,
+                                                                         unsigned int            n_rects,
+                                                                         const graphene_rect_t   rects[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_tile_binner_add_quads          (graphene_tile_binner_t *b,
+                                                                         unsigned int            n_quads,
+                                                                         const graphene_quad_t   quads[]);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_tile_binner_get_grid_size      (const graphene_tile_binner_t *b,
+                                                                         unsigned int                 *n_columns,
+                                                                         unsigned int                 *n_rows);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int                    graphene_tile_binner_get_n_items        (const graphene_tile_binner_t *b);
+GRAPHENE_AVAILABLE_IN_1_4
+const unsigned int *            graphene_tile_binner_get_tile           (graphene_tile_binner_t *b,
+                                                                         unsigned int            column,
+                                                                         unsigned int            row,
+                                                                         unsigned int           *n_indices);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_TILE_BINNER_H__ */
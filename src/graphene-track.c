@@ -0,0 +1,810 @@
+/* graphene-track.c: Keyframe animation tracks
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-track
+ * @Title: Track
+ * @Short_Description: Keyframe animation tracks
+ *
+ * #graphene_track_t stores a list of keys, each one with a time and a
+ * value, and samples the value at any given time by interpolating the
+ * two keys around it. The values can be vectors, like a translation or
+ * a scale factor; quaternions, like the rotation of a bone; or whole
+ * transformation matrices.
+ *
+ * Sampling a track has to find the keys around the time value, which
+ * requires a binary search on the keys. Animations usually sample tracks
+ * at increasing times, though, so each animated instance can keep a
+ * #graphene_track_cursor_t with the position of its last sample; when
+ * the time value falls inside the same pair of keys, or the following
+ * one, the search is skipped entirely.
+ *
+ * The work needed by each interpolation is done when initializing the
+ * track: quaternion keys are flipped to lie on the same hemisphere as
+ * the previous key, so that every interpolation follows the shortest
+ * path between two rotations; and matrix keys are decomposed once, and
+ * not every time they are sampled.
+ *
+ * graphene_track_sample_array() samples many tracks of the same type at
+ * the same time, and writes the results of each component in separate
+ * planes, which is the layout expected by vectorized skinning and
+ * blending code.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-track.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-matrix.h"
+#include "graphene-quaternion.h"
+#include "graphene-quaternion-private.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+#include "graphene-vec3.h"
+
+#include <string.h>
+
+/**
+ * graphene_track_t:
+ *
+ * An opaque structure holding the keys of an animation track.
+ *
+ * Since: 1.4
+ */
+struct _graphene_track_t
+{
+  graphene_track_type_t type;
+  graphene_track_interpolation_t interpolation;
+
+  unsigned int n_keys;
+  float *times;
+
+  /* one vector per key, or four rows per key for matrix tracks */
+  graphene_simd4f_t *values;
+
+  /* the decomposed segments between matrix keys, if needed */
+  graphene_matrix_interpolator_t *segments;
+};
+
+/**
+ * graphene_track_cursor_init:
+ * @cursor: the #graphene_track_cursor_t to initialize
+ *
+ * Initializes a #graphene_track_cursor_t to the first key of a track.
+ *
+ * Returns: (transfer none): the initialized cursor
+ *
+ * Since: 1.4
+ */
+graphene_track_cursor_t *
+graphene_track_cursor_init (graphene_track_cursor_t *cursor)
+{
+  cursor->key = 0;
+
+  return cursor;
+}
+
+/**
+ * graphene_track_alloc: (constructor)
+ *
+ * Allocates a new #graphene_track_t.
+ *
+ * The returned track has no keys; use one of the initialization
+ * functions to set them.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_track_t.
+ *   Use graphene_track_free() to free the resources allocated by
+ *   this function
+ *
+ * Since: 1.4
+ */
+graphene_track_t *
+graphene_track_alloc (void)
+{
+  return calloc (1, sizeof (graphene_track_t));
+}
+
+static void
+track_clear (graphene_track_t *t)
+{
+  free (t->times);
+  graphene_aligned_free (t->values);
+  graphene_aligned_free (t->segments);
+
+  t->times = NULL;
+  t->values = NULL;
+  t->segments = NULL;
+  t->n_keys = 0;
+}
+
+/**
+ * graphene_track_free:
+ * @t: a #graphene_track_t
+ *
+ * Frees the resources allocated by graphene_track_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_track_free (graphene_track_t *t)
+{
+  if (t == NULL)
+    return;
+
+  track_clear (t);
+  free (t);
+}
+
+/*< private >
+ * track_init_keys:
+ * @t: a #graphene_track_t
+ * @type: the type of the keys
+ * @interpolation: the interpolation between keys
+ * @n_keys: the number of keys
+ * @times: the times of the keys
+ * @n_rows: the number of vectors used by each key
+ *
+ * Replaces the keys of @t, and allocates enough space to store the
+ * values of the new keys.
+ *
+ * Returns: the values of the keys
+ */
+static graphene_simd4f_t *
+track_init_keys (graphene_track_t               *t,
+                 graphene_track_type_t           type,
+                 graphene_track_interpolation_t  interpolation,
+                 unsigned int                    n_keys,
+                 const float                     times[],
+                 unsigned int                    n_rows)
+{
+  track_clear (t);
+
+  t->type = type;
+  t->interpolation = interpolation;
+
+  if (n_keys == 0)
+    return NULL;
+
+  t->n_keys = n_keys;
+  t->times = malloc (n_keys * sizeof (float));
+  memcpy (t->times, times, n_keys * sizeof (float));
+
+  t->values = graphene_aligned_alloc (sizeof (graphene_simd4f_t), n_keys * n_rows, 16);
+
+  return t->values;
+}
+
+/**
+ * graphene_track_init_vec3:
+ * @t: the #graphene_track_t to initialize
+ * @interpolation: the interpolation between keys
+ * @n_keys: the number of keys
+ * @times: (array length=n_keys): the times of the keys, in increasing order
+ * @values: (array length=n_keys): the values of the keys
+ *
+ * Initializes a #graphene_track_t with vector keys, replacing any
+ * previous key.
+ *
+ * Returns: (transfer none): the initialized track
+ *
+ * Since: 1.4
+ */
+graphene_track_t *
+graphene_track_init_vec3 (graphene_track_t               *t,
+                          graphene_track_interpolation_t  interpolation,
+                          unsigned int                    n_keys,
+                          const float                     times[],
+                          const graphene_vec3_t           values[])
+{
+  graphene_simd4f_t *v;
+  unsigned int i;
+
+  v = track_init_keys (t, GRAPHENE_TRACK_VEC3, interpolation, n_keys, times, 1);
+
+  for (i = 0; i < n_keys; i++)
+    v[i] = values[i].value;
+
+  return t;
+}
+
+/**
+ * graphene_track_init_quaternion:
+ * @t: the #graphene_track_t to initialize
+ * @interpolation: the interpolation between keys
+ * @n_keys: the number of keys
+ * @times: (array length=n_keys): the times of the keys, in increasing order
+ * @values: (array length=n_keys): the values of the keys
+ *
+ * Initializes a #graphene_track_t with quaternion keys, replacing any
+ * previous key.
+ *
+ * Each key is negated, if needed, so that the interpolation between two
+ * keys always follows the shortest path between the two rotations.
+ *
+ * Returns: (transfer none): the initialized track
+ *
+ * Since: 1.4
+ */
+graphene_track_t *
+graphene_track_init_quaternion (graphene_track_t               *t,
+                                graphene_track_interpolation_t  interpolation,
+                                unsigned int                    n_keys,
+                                const float                     times[],
+                                const graphene_quaternion_t     values[])
+{
+  graphene_simd4f_t *v;
+  unsigned int i;
+
+  v = track_init_keys (t, GRAPHENE_TRACK_QUATERNION, interpolation, n_keys, times, 1);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      v[i] = graphene_quaternion_load (&values[i]);
+
+      if (i > 0 && graphene_quaternion_simd_dot (v[i - 1], v[i]) < 0.f)
+        v[i] = graphene_simd4f_neg (v[i]);
+    }
+
+  return t;
+}
+
+/**
+ * graphene_track_init_matrix:
+ * @t: the #graphene_track_t to initialize
+ * @interpolation: the interpolation between keys
+ * @n_keys: the number of keys
+ * @times: (array length=n_keys): the times of the keys, in increasing order
+ * @values: (array length=n_keys): the values of the keys
+ *
+ * Initializes a #graphene_track_t with matrix keys, replacing any
+ * previous key.
+ *
+ * Unless @interpolation is %GRAPHENE_TRACK_INTERPOLATION_LINEAR, each
+ * pair of keys is decomposed using a #graphene_matrix_interpolator_t.
+ *
+ * Returns: (transfer none): the initialized track
+ *
+ * Since: 1.4
+ */
+graphene_track_t *
+graphene_track_init_matrix (graphene_track_t               *t,
+                            graphene_track_interpolation_t  interpolation,
+                            unsigned int                    n_keys,
+                            const float                     times[],
+                            const graphene_matrix_t         values[])
+{
+  graphene_simd4f_t *v;
+  unsigned int i;
+
+  v = track_init_keys (t, GRAPHENE_TRACK_MATRIX, interpolation, n_keys, times, 4);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      v[i * 4 + 0] = values[i].value.x;
+      v[i * 4 + 1] = values[i].value.y;
+      v[i * 4 + 2] = values[i].value.z;
+      v[i * 4 + 3] = values[i].value.w;
+    }
+
+  if (interpolation != GRAPHENE_TRACK_INTERPOLATION_LINEAR && n_keys > 1)
+    {
+      t->segments = graphene_aligned_alloc (sizeof (graphene_matrix_interpolator_t), n_keys - 1, 16);
+
+      for (i = 0; i < n_keys - 1; i++)
+        graphene_matrix_interpolator_init (&t->segments[i], &values[i], &values[i + 1]);
+    }
+
+  return t;
+}
+
+/**
+ * graphene_track_get_track_type:
+ * @t: a #graphene_track_t
+ *
+ * Retrieves the type of the keys of a #graphene_track_t.
+ *
+ * Returns: the type of the keys
+ *
+ * Since: 1.4
+ */
+graphene_track_type_t
+graphene_track_get_track_type (const graphene_track_t *t)
+{
+  return t->type;
+}
+
+/**
+ * graphene_track_get_interpolation:
+ * @t: a #graphene_track_t
+ *
+ * Retrieves the interpolation used between the keys of a #graphene_track_t.
+ *
+ * Returns: the interpolation
+ *
+ * Since: 1.4
+ */
+graphene_track_interpolation_t
+graphene_track_get_interpolation (const graphene_track_t *t)
+{
+  return t->interpolation;
+}
+
+/**
+ * graphene_track_get_n_keys:
+ * @t: a #graphene_track_t
+ *
+ * Retrieves the number of keys of a #graphene_track_t.
+ *
+ * Returns: the number of keys
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_track_get_n_keys (const graphene_track_t *t)
+{
+  return t->n_keys;
+}
+
+/**
+ * graphene_track_get_time_range:
+ * @t: a #graphene_track_t
+ * @start: (out) (optional): return location for the time of the first key
+ * @end: (out) (optional): return location for the time of the last key
+ *
+ * Retrieves the times of the first and last keys of a #graphene_track_t.
+ *
+ * If the track has no keys, both times are set to 0.
+ *
+ * Since: 1.4
+ */
+void
+graphene_track_get_time_range (const graphene_track_t *t,
+                               float                  *start,
+                               float                  *end)
+{
+  if (start != NULL)
+    *start = t->n_keys > 0 ? t->times[0] : 0.f;
+
+  if (end != NULL)
+    *end = t->n_keys > 0 ? t->times[t->n_keys - 1] : 0.f;
+}
+
+/*< private >
+ * track_find_segment:
+ * @t: a #graphene_track_t with at least two keys
+ * @cursor: (nullable): a #graphene_track_cursor_t
+ * @time: the time value
+ *
+ * Finds the segment of @t containing @time; times before the first key
+ * map to the first segment, and times after the last key map to the last
+ * segment.
+ *
+ * If @cursor is set, and @time lies inside the segment it points to, or
+ * inside the following one, no search is performed; otherwise, the
+ * segment is found with a binary search, and stored in @cursor.
+ *
+ * Returns: the index of the first key of the segment
+ */
+static unsigned int
+track_find_segment (const graphene_track_t  *t,
+                    graphene_track_cursor_t *cursor,
+                    float                    time)
+{
+  const float *times = t->times;
+  unsigned int last = t->n_keys - 1;
+  unsigned int lo, hi;
+
+  if (cursor != NULL && cursor->key < last)
+    {
+      lo = cursor->key;
+
+      if (time >= times[lo])
+        {
+          if (time < times[lo + 1])
+            return lo;
+
+          if (lo + 2 <= last && time < times[lo + 2])
+            {
+              cursor->key = lo + 1;
+              return lo + 1;
+            }
+        }
+    }
+
+  if (time < times[1])
+    lo = 0;
+  else if (time >= times[last - 1])
+    lo = last - 1;
+  else
+    {
+      /* times[lo] <= time < times[hi] */
+      lo = 1;
+      hi = last - 1;
+
+      while (hi - lo > 1)
+        {
+          unsigned int mid = (lo + hi) / 2;
+
+          if (times[mid] <= time)
+            lo = mid;
+          else
+            hi = mid;
+        }
+    }
+
+  if (cursor != NULL)
+    cursor->key = lo;
+
+  return lo;
+}
+
+/*< private >
+ * track_cubic:
+ * @t: a #graphene_track_t
+ * @k: the first key of the segment
+ * @u: the position inside the segment, between 0 and 1
+ *
+ * Evaluates the Catmull-Rom spline through the keys of @t at the given
+ * position; the tangents are scaled by the length of the segment, so
+ * that keys that are not evenly spaced in time do not overshoot.
+ *
+ * Returns: the interpolated value
+ */
+static inline graphene_simd4f_t
+track_cubic (const graphene_track_t *t,
+             unsigned int            k,
+             float                   u)
+{
+  const graphene_simd4f_t *v = t->values;
+  const float *times = t->times;
+  graphene_simd4f_t p0, p1, p2, p3, m1, m2, res;
+  float t0, t1, t2, t3, h, u2, u3, h00, h10, h11;
+
+  p1 = v[k];
+  p2 = v[k + 1];
+  t1 = times[k];
+  t2 = times[k + 1];
+
+  p0 = k > 0 ? v[k - 1] : p1;
+  t0 = k > 0 ? times[k - 1] : t1;
+  p3 = k + 2 < t->n_keys ? v[k + 2] : p2;
+  t3 = k + 2 < t->n_keys ? times[k + 2] : t2;
+
+  h = t2 - t1;
+  m1 = graphene_simd4f_mul (graphene_simd4f_sub (p2, p0),
+                            graphene_simd4f_splat (t2 > t0 ? h / (t2 - t0) : 0.f));
+  m2 = graphene_simd4f_mul (graphene_simd4f_sub (p3, p1),
+                            graphene_simd4f_splat (t3 > t1 ? h / (t3 - t1) : 0.f));
+
+  /* cubic Hermite basis; the weight of p2 is 1 - h00 */
+  u2 = u * u;
+  u3 = u2 * u;
+  h00 = 2.f * u3 - 3.f * u2 + 1.f;
+  h10 = u3 - 2.f * u2 + u;
+  h11 = u3 - u2;
+
+  res = graphene_simd4f_madd (graphene_simd4f_sub (p1, p2), graphene_simd4f_splat (h00), p2);
+  res = graphene_simd4f_madd (m1, graphene_simd4f_splat (h10), res);
+  res = graphene_simd4f_madd (m2, graphene_simd4f_splat (h11), res);
+
+  return res;
+}
+
+/*< private >
+ * track_sample:
+ * @t: a #graphene_track_t
+ * @cursor: (nullable): a #graphene_track_cursor_t
+ * @time: the time value
+ * @res: (out) (array fixed-size=4): return location for the sampled
+ *   value; matrix tracks use four rows, every other track uses one
+ *
+ * Samples a #graphene_track_t at the given time.
+ */
+static void
+track_sample (const graphene_track_t  *t,
+              graphene_track_cursor_t *cursor,
+              float                    time,
+              graphene_simd4f_t        res[])
+{
+  const graphene_simd4f_t *v = t->values;
+  graphene_simd4f_t a, b;
+  unsigned int k;
+  float t0, t1, u;
+
+  if (t->n_keys == 0)
+    {
+      const graphene_simd4f_t zero = graphene_simd4f_splat (0.f);
+
+      if (t->type == GRAPHENE_TRACK_VEC3)
+        res[0] = zero;
+      else if (t->type == GRAPHENE_TRACK_QUATERNION)
+        res[0] = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+      else
+        {
+          res[0] = graphene_simd4f_init (1.f, 0.f, 0.f, 0.f);
+          res[1] = graphene_simd4f_init (0.f, 1.f, 0.f, 0.f);
+          res[2] = graphene_simd4f_init (0.f, 0.f, 1.f, 0.f);
+          res[3] = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+        }
+
+      return;
+    }
+
+  if (t->n_keys == 1)
+    {
+      memcpy (res, v, sizeof (graphene_simd4f_t) * (t->type == GRAPHENE_TRACK_MATRIX ? 4 : 1));
+      return;
+    }
+
+  k = track_find_segment (t, cursor, time);
+
+  t0 = t->times[k];
+  t1 = t->times[k + 1];
+  if (t1 > t0)
+    u = CLAMP ((time - t0) / (t1 - t0), 0.f, 1.f);
+  else
+    u = time < t0 ? 0.f : 1.f;
+
+  if (t->type == GRAPHENE_TRACK_MATRIX)
+    {
+      const graphene_simd4f_t f = graphene_simd4f_splat (u);
+      unsigned int i;
+
+      if (t->segments != NULL && graphene_matrix_interpolator_is_valid (&t->segments[k]))
+        {
+          graphene_matrix_t m;
+
+          graphene_matrix_interpolator_interpolate (&t->segments[k], u, &m);
+
+          res[0] = m.value.x;
+          res[1] = m.value.y;
+          res[2] = m.value.z;
+          res[3] = m.value.w;
+          return;
+        }
+
+      for (i = 0; i < 4; i++)
+        {
+          a = v[k * 4 + i];
+          b = v[k * 4 + 4 + i];
+          res[i] = graphene_simd4f_madd (graphene_simd4f_sub (b, a), f, a);
+        }
+
+      return;
+    }
+
+  a = v[k];
+  b = v[k + 1];
+
+  switch (t->interpolation)
+    {
+    case GRAPHENE_TRACK_INTERPOLATION_SLERP:
+      if (t->type == GRAPHENE_TRACK_QUATERNION)
+        {
+          res[0] = graphene_quaternion_simd_slerp (a, b, u);
+          return;
+        }
+
+      res[0] = graphene_simd4f_madd (graphene_simd4f_sub (b, a), graphene_simd4f_splat (u), a);
+      break;
+
+    case GRAPHENE_TRACK_INTERPOLATION_CUBIC:
+      res[0] = track_cubic (t, k, u);
+      break;
+
+    case GRAPHENE_TRACK_INTERPOLATION_LINEAR:
+    default:
+      res[0] = graphene_simd4f_madd (graphene_simd4f_sub (b, a), graphene_simd4f_splat (u), a);
+      break;
+    }
+
+  if (t->type == GRAPHENE_TRACK_QUATERNION)
+    res[0] = graphene_quaternion_simd_normalize (res[0]);
+}
+
+/**
+ * graphene_track_sample_vec3:
+ * @t: a #graphene_track_t with vector keys
+ * @cursor: (nullable): a #graphene_track_cursor_t
+ * @time: the time value
+ * @res: (out caller-allocates): return location for the sampled vector
+ *
+ * Samples a #graphene_track_t initialized with graphene_track_init_vec3()
+ * at the given @time.
+ *
+ * Times before the first key, or after the last key, are clamped to
+ * the value of the first and last key, respectively.
+ *
+ * If @cursor is not %NULL, it is used to skip the search of the keys
+ * around @time, and it is updated with the position of the sample.
+ *
+ * Since: 1.4
+ */
+void
+graphene_track_sample_vec3 (const graphene_track_t  *t,
+                            graphene_track_cursor_t *cursor,
+                            float                    time,
+                            graphene_vec3_t         *res)
+{
+  graphene_simd4f_t v[4];
+
+  track_sample (t, cursor, time, v);
+
+  res->value = graphene_simd4f_zero_w (v[0]);
+}
+
+/**
+ * graphene_track_sample_quaternion:
+ * @t: a #graphene_track_t with quaternion keys
+ * @cursor: (nullable): a #graphene_track_cursor_t
+ * @time: the time value
+ * @res: (out caller-allocates): return location for the sampled quaternion
+ *
+ * Samples a #graphene_track_t initialized with graphene_track_init_quaternion()
+ * at the given @time; see graphene_track_sample_vec3().
+ *
+ * Since: 1.4
+ */
+void
+graphene_track_sample_quaternion (const graphene_track_t  *t,
+                                  graphene_track_cursor_t *cursor,
+                                  float                    time,
+                                  graphene_quaternion_t   *res)
+{
+  graphene_simd4f_t v[4];
+
+  track_sample (t, cursor, time, v);
+
+  graphene_quaternion_store (v[0], res);
+}
+
+/**
+ * graphene_track_sample_matrix:
+ * @t: a #graphene_track_t with matrix keys
+ * @cursor: (nullable): a #graphene_track_cursor_t
+ * @time: the time value
+ * @res: (out caller-allocates): return location for the sampled matrix
+ *
+ * Samples a #graphene_track_t initialized with graphene_track_init_matrix()
+ * at the given @time; see graphene_track_sample_vec3().
+ *
+ * Since: 1.4
+ */
+void
+graphene_track_sample_matrix (const graphene_track_t  *t,
+                              graphene_track_cursor_t *cursor,
+                              float                    time,
+                              graphene_matrix_t       *res)
+{
+  graphene_simd4f_t v[4];
+
+  track_sample (t, cursor, time, v);
+
+  res->value.x = v[0];
+  res->value.y = v[1];
+  res->value.z = v[2];
+  res->value.w = v[3];
+}
+
+static inline void
+store_lanes (const graphene_simd4f_t  v,
+             unsigned int             n,
+             float                   *res)
+{
+  float tmp[4];
+  unsigned int i;
+
+  if (n == 4)
+    {
+      graphene_simd4f_dup_4f (v, res);
+      return;
+    }
+
+  graphene_simd4f_dup_4f (v, tmp);
+  for (i = 0; i < n; i++)
+    res[i] = tmp[i];
+}
+
+/**
+ * graphene_track_sample_array:
+ * @n_tracks: the number of tracks
+ * @tracks: (array length=n_tracks): an array of tracks with the same type
+ * @cursors: (array length=n_tracks) (nullable): an array of cursors, one
+ *   for each track
+ * @time: the time value
+ * @res: (out caller-allocates): return location for the sampled values
+ *
+ * Samples all the @tracks at the given @time, and stores the values
+ * in the @res array one component at a time: the first @n_tracks
+ * elements contain the first component of each sample, followed by
+ * the second component of each sample, and so on.
+ *
+ * Vector tracks have 3 components; quaternion tracks have 4 components;
+ * and matrix tracks have 16 components, in row major order. The @res
+ * array must be large enough to store the components of all the samples.
+ *
+ * Since: 1.4
+ */
+void
+graphene_track_sample_array (unsigned int            n_tracks,
+                             const graphene_track_t *tracks[],
+                             graphene_track_cursor_t cursors[],
+                             float                   time,
+                             float                   res[])
+{
+  unsigned int i, n_rows, n_components;
+
+  if (n_tracks == 0)
+    return;
+
+  switch (tracks[0]->type)
+    {
+    case GRAPHENE_TRACK_VEC3:
+      n_rows = 1;
+      n_components = 3;
+      break;
+
+    case GRAPHENE_TRACK_QUATERNION:
+      n_rows = 1;
+      n_components = 4;
+      break;
+
+    case GRAPHENE_TRACK_MATRIX:
+    default:
+      n_rows = 4;
+      n_components = 4;
+      break;
+    }
+
+  for (i = 0; i < n_tracks; i += 4)
+    {
+      unsigned int n = MIN (n_tracks - i, 4);
+      graphene_simd4f_t samples[4][4];
+      unsigned int j, row;
+
+      memset (samples, 0, sizeof (samples));
+
+      for (j = 0; j < n; j++)
+        track_sample (tracks[i + j], cursors != NULL ? &cursors[i + j] : NULL, time, samples[j]);
+
+      /* transposing the same row of four samples yields the
+       * same component of the four samples in each vector
+       */
+      for (row = 0; row < n_rows; row++)
+        {
+          graphene_simd4x4f_t m;
+          float *plane = res + (row * 4) * n_tracks + i;
+
+          m = graphene_simd4x4f_init (samples[0][row], samples[1][row],
+                                      samples[2][row], samples[3][row]);
+          graphene_simd4x4f_transpose_in_place (&m);
+
+          store_lanes (m.x, n, plane);
+          store_lanes (m.y, n, plane + n_tracks);
+          store_lanes (m.z, n, plane + 2 * n_tracks);
+          if (n_components > 3)
+            store_lanes (m.w, n, plane + 3 * n_tracks);
+        }
+    }
+}
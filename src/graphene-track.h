@@ -0,0 +1,158 @@
+/* graphene-track.h: Keyframe animation tracks
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_TRACK_H__
+#define __GRAPHENE_TRACK_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-matrix.h"
+#include "graphene-quaternion.h"
+#include "graphene-vec3.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_track_type_t:
+ * @GRAPHENE_TRACK_VEC3: The keys are #graphene_vec3_t
+ * @GRAPHENE_TRACK_QUATERNION: The keys are #graphene_quaternion_t
+ * @GRAPHENE_TRACK_MATRIX: The keys are #graphene_matrix_t
+ *
+ * The type of the keys of a #graphene_track_t.
+ *
+ * Since: 1.4
+ */
+typedef enum {
+  GRAPHENE_TRACK_VEC3,
+  GRAPHENE_TRACK_QUATERNION,
+  GRAPHENE_TRACK_MATRIX
+} graphene_track_type_t;
+
+/**
+ * graphene_track_interpolation_t:
+ * @GRAPHENE_TRACK_INTERPOLATION_LINEAR: Linear interpolation; quaternions
+ *   are normalized after the interpolation, and matrices are interpolated
+ *   element by element
+ * @GRAPHENE_TRACK_INTERPOLATION_SLERP: Spherical linear interpolation of
+ *   quaternions; matrices are decomposed, and their rotations interpolated
+ *   spherically, like graphene_matrix_interpolate() does. Vectors are
+ *   interpolated linearly
+ * @GRAPHENE_TRACK_INTERPOLATION_CUBIC: Catmull-Rom cubic interpolation,
+ *   using the keys around each segment to compute the tangents; matrices
+ *   are interpolated like %GRAPHENE_TRACK_INTERPOLATION_SLERP
+ *
+ * The interpolation used to sample a #graphene_track_t between two keys.
+ *
+ * Since: 1.4
+ */
+typedef enum {
+  GRAPHENE_TRACK_INTERPOLATION_LINEAR,
+  GRAPHENE_TRACK_INTERPOLATION_SLERP,
+  GRAPHENE_TRACK_INTERPOLATION_CUBIC
+} graphene_track_interpolation_t;
+
+/**
+ * graphene_track_cursor_t:
+ *
+ * A cursor caching the position of the last sample of a #graphene_track_t.
+ *
+ * Each animated instance sampling a track should use its own cursor;
+ * the cursor can be shared between tracks with the same key times.
+ *
+ * The contents of a #graphene_track_cursor_t are private and should
+ * never be accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_track_cursor_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (unsigned int, key);
+};
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_track_cursor_t *       graphene_track_cursor_init              (graphene_track_cursor_t *cursor);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_track_t *              graphene_track_alloc                    (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_track_free                     (graphene_track_t *t);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_track_t *              graphene_track_init_vec3                (graphene_track_t               *t,
+                                                                         graphene_track_interpolation_t  interpolation,
+                                                                         unsigned int                    n_keys,
+                                                                         const float                     times[],
+                                                                         const graphene_vec3_t           values[]);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_track_t *              graphene_track_init_quaternion          (graphene_track_t               *t,
+                                                                         graphene_track_interpolation_t  interpolation,
+                                                                         unsigned int                    n_keys,
+                                                                         const float                     times[],
+                                                                         const graphene_quaternion_t     values[]);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_track_t *              graphene_track_init_matrix              (graphene_track_t               *t,
+                                                                         graphene_track_interpolation_t  interpolation,
+                                                                         unsigned int                    n_keys,
+                                                                         const float                     times[],
+                                                                         const graphene_matrix_t         values[]);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_track_type_t           graphene_track_get_track_type           (const graphene_track_t *t);
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_track_interpolation_t  graphene_track_get_interpolation        (const graphene_track_t *t);
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int                    graphene_track_get_n_keys               (const graphene_track_t *t);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_track_get_time_range           (const graphene_track_t *t,
+                                                                         float                  *start,
+                                                                         float                  *end);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_track_sample_vec3              (const graphene_track_t  *t,
+                                                                         graphene_track_cursor_t *cursor,
+                                                                         float                    time,
+                                                                         graphene_vec3_t         *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_track_sample_quaternion        (const graphene_track_t  *t,
+                                                                         graphene_track_cursor_t *cursor,
+                                                                         float                    time,
+                                                                         graphene_quaternion_t   *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_track_sample_matrix            (const graphene_track_t  *t,
+                                                                         graphene_track_cursor_t *cursor,
+                                                                         float                    time,
+                                                                         graphene_matrix_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_track_sample_array             (unsigned int             n_tracks,
+                                                                         const graphene_track_t  *tracks[],
+                                                                         graphene_track_cursor_t  cursors[],
+                                                                         float                    time,
+                                                                         float                    res[]);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_TRACK_H__ */
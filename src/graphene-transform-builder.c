@@ -0,0 +1,436 @@
+/* graphene-transform-builder.c: Transformation builder
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-transform-builder
+ * @Title: Transform builder
+ * @Short_Description: Composition of transformation chains
+ *
+ * #graphene_transform_builder_t records a sequence of transformations,
+ * like the list of functions of a CSS transform, and composes them into
+ * a single #graphene_matrix_t.
+ *
+ * Each transformation is applied like the corresponding #graphene_matrix_t
+ * function, for instance graphene_matrix_translate() and
+ * graphene_matrix_rotate(), on the result of the previous ones, starting
+ * from the identity matrix; the following two blocks of code compute
+ * the same matrix:
+ *
+ * |[<!-- language="C" -->
+ *   graphene_matrix_init_identity (&m);
+ *   graphene_matrix_translate (&m, &pos);
+ *   graphene_matrix_rotate (&m, 45.f, graphene_vec3_z_axis ());
+ *   graphene_matrix_scale (&m, 2.f, 2.f, 1.f);
+ *
+ *   graphene_transform_builder_init (b);
+ *   graphene_transform_builder_translate (b, &pos);
+ *   graphene_transform_builder_rotate (b, 45.f, graphene_vec3_z_axis ());
+ *   graphene_transform_builder_scale (b, 2.f, 2.f, 1.f);
+ *   graphene_transform_builder_to_matrix (b, &m);
+ * ]|
+ *
+ * Consecutive translations, consecutive scales, and consecutive rotations
+ * around the same coordinate axis are merged when they are recorded. The
+ * composition then runs in a single pass over the recorded operations,
+ * and only updates the rows of the matrix affected by each of them: a
+ * translation only changes the last row, a scale multiplies the first
+ * three rows, and a rotation around a coordinate axis mixes two rows.
+ * Only arbitrary matrices require a full 4x4 multiplication.
+ *
+ * The memory used by the builder is retained when re-initializing it,
+ * so that building a transformation chain does not require allocations.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-transform-builder.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-matrix-private.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum {
+  TRANSFORM_OP_TRANSLATE,
+  TRANSFORM_OP_SCALE,
+  TRANSFORM_OP_ROTATE,
+  TRANSFORM_OP_ROTATE_X,
+  TRANSFORM_OP_ROTATE_Y,
+  TRANSFORM_OP_ROTATE_Z,
+  TRANSFORM_OP_MATRIX
+} transform_op_type_t;
+
+typedef struct {
+  transform_op_type_t type;
+
+  /* the translation, the scale factors, or the axis of the rotation
+   * and its angle in radians; or the rows of the matrix
+   */
+  float v[16];
+} transform_op_t;
+
+/**
+ * graphene_transform_builder_t:
+ *
+ * An opaque structure used to compose a sequence of transformations.
+ *
+ * Since: 1.4
+ */
+struct _graphene_transform_builder_t
+{
+  transform_op_t *ops;
+  unsigned int n_ops;
+  unsigned int ops_size;
+};
+
+/**
+ * graphene_transform_builder_alloc: (constructor)
+ *
+ * Allocates a new #graphene_transform_builder_t.
+ *
+ * The contents of the returned structure are undefined until
+ * graphene_transform_builder_init() is called.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_transform_builder_t.
+ *   Use graphene_transform_builder_free() to free the resources allocated
+ *   by this function
+ *
+ * Since: 1.4
+ */
+graphene_transform_builder_t *
+graphene_transform_builder_alloc (void)
+{
+  return calloc (1, sizeof (graphene_transform_builder_t));
+}
+
+/**
+ * graphene_transform_builder_free:
+ * @b: a #graphene_transform_builder_t
+ *
+ * Frees the resources allocated by graphene_transform_builder_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_transform_builder_free (graphene_transform_builder_t *b)
+{
+  if (b == NULL)
+    return;
+
+  graphene_aligned_free (b->ops);
+  free (b);
+}
+
+/**
+ * graphene_transform_builder_init:
+ * @b: the #graphene_transform_builder_t to initialize
+ *
+ * Initializes a #graphene_transform_builder_t, and removes all the
+ * transformations previously recorded.
+ *
+ * Returns: (transfer none): the initialized #graphene_transform_builder_t
+ *
+ * Since: 1.4
+ */
+graphene_transform_builder_t *
+graphene_transform_builder_init (graphene_transform_builder_t *b)
+{
+  b->n_ops = 0;
+
+  return b;
+}
+
+/*< private >
+ * transform_builder_last_op:
+ * @b: a #graphene_transform_builder_t
+ * @type: the type of the operation
+ *
+ * Retrieves the last recorded operation, if it has the given @type.
+ *
+ * Returns: the last operation, or %NULL
+ */
+static inline transform_op_t *
+transform_builder_last_op (graphene_transform_builder_t *b,
+                           transform_op_type_t           type)
+{
+  if (b->n_ops > 0 && b->ops[b->n_ops - 1].type == type)
+    return &b->ops[b->n_ops - 1];
+
+  return NULL;
+}
+
+/*< private >
+ * transform_builder_add_op:
+ * @b: a #graphene_transform_builder_t
+ * @type: the type of the operation
+ *
+ * Appends a new operation, growing the storage if needed.
+ *
+ * Returns: the new operation
+ */
+static transform_op_t *
+transform_builder_add_op (graphene_transform_builder_t *b,
+                          transform_op_type_t           type)
+{
+  transform_op_t *op;
+
+  if (b->n_ops == b->ops_size)
+    {
+      unsigned int size = b->ops_size > 0 ? b->ops_size * 2 : 8;
+      transform_op_t *ops;
+
+      /* graphene_aligned_alloc() aborts if the allocation fails, so
+       * the previous operations are never lost
+       */
+      ops = graphene_aligned_alloc (sizeof (transform_op_t), size, 16);
+      if (b->n_ops > 0)
+        memcpy (ops, b->ops, b->n_ops * sizeof (transform_op_t));
+
+      graphene_aligned_free (b->ops);
+      b->ops = ops;
+      b->ops_size = size;
+    }
+
+  op = &b->ops[b->n_ops++];
+  op->type = type;
+
+  return op;
+}
+
+/**
+ * graphene_transform_builder_translate:
+ * @b: a #graphene_transform_builder_t
+ * @pos: a #graphene_point3d_t
+ *
+ * Records a translation; see graphene_matrix_translate().
+ *
+ * Since: 1.4
+ */
+void
+graphene_transform_builder_translate (graphene_transform_builder_t *b,
+                                      const graphene_point3d_t     *pos)
+{
+  transform_op_t *op = transform_builder_last_op (b, TRANSFORM_OP_TRANSLATE);
+
+  if (op != NULL)
+    {
+      op->v[0] += pos->x;
+      op->v[1] += pos->y;
+      op->v[2] += pos->z;
+      return;
+    }
+
+  op = transform_builder_add_op (b, TRANSFORM_OP_TRANSLATE);
+  op->v[0] = pos->x;
+  op->v[1] = pos->y;
+  op->v[2] = pos->z;
+  op->v[3] = 0.f;
+}
+
+/**
+ * graphene_transform_builder_scale:
+ * @b: a #graphene_transform_builder_t
+ * @factor_x: scaling factor on the X axis
+ * @factor_y: scaling factor on the Y axis
+ * @factor_z: scaling factor on the Z axis
+ *
+ * Records a scaling transformation; see graphene_matrix_scale().
+ *
+ * Since: 1.4
+ */
+void
+graphene_transform_builder_scale (graphene_transform_builder_t *b,
+                                  float                         factor_x,
+                                  float                         factor_y,
+                                  float                         factor_z)
+{
+  transform_op_t *op = transform_builder_last_op (b, TRANSFORM_OP_SCALE);
+
+  if (op != NULL)
+    {
+      op->v[0] *= factor_x;
+      op->v[1] *= factor_y;
+      op->v[2] *= factor_z;
+      return;
+    }
+
+  op = transform_builder_add_op (b, TRANSFORM_OP_SCALE);
+  op->v[0] = factor_x;
+  op->v[1] = factor_y;
+  op->v[2] = factor_z;
+  op->v[3] = 1.f;
+}
+
+/**
+ * graphene_transform_builder_rotate:
+ * @b: a #graphene_transform_builder_t
+ * @angle: the rotation angle, in degrees
+ * @axis: the rotation axis, as a #graphene_vec3_t
+ *
+ * Records a rotation around the given @axis; see graphene_matrix_rotate().
+ *
+ * Rotations around the X, Y, and Z axes are recognized, and composed
+ * without computing the whole rotation matrix.
+ *
+ * Since: 1.4
+ */
+void
+graphene_transform_builder_rotate (graphene_transform_builder_t *b,
+                                   float                         angle,
+                                   const graphene_vec3_t        *axis)
+{
+  transform_op_type_t type = TRANSFORM_OP_ROTATE;
+  transform_op_t *op;
+  float v[3];
+
+  graphene_vec3_to_float (axis, v);
+
+  if (v[0] > 0.f && v[1] == 0.f && v[2] == 0.f)
+    type = TRANSFORM_OP_ROTATE_X;
+  else if (v[0] == 0.f && v[1] > 0.f && v[2] == 0.f)
+    type = TRANSFORM_OP_ROTATE_Y;
+  else if (v[0] == 0.f && v[1] == 0.f && v[2] > 0.f)
+    type = TRANSFORM_OP_ROTATE_Z;
+
+  if (type != TRANSFORM_OP_ROTATE)
+    {
+      op = transform_builder_last_op (b, type);
+      if (op != NULL)
+        {
+          op->v[3] += GRAPHENE_DEG_TO_RAD (angle);
+          return;
+        }
+    }
+
+  op = transform_builder_add_op (b, type);
+  op->v[0] = v[0];
+  op->v[1] = v[1];
+  op->v[2] = v[2];
+  op->v[3] = GRAPHENE_DEG_TO_RAD (angle);
+}
+
+/**
+ * graphene_transform_builder_transform:
+ * @b: a #graphene_transform_builder_t
+ * @m: a #graphene_matrix_t
+ *
+ * Records an arbitrary transformation, like a skew or a perspective,
+ * expressed by the given matrix.
+ *
+ * The matrix is applied before the transformations recorded so far,
+ * like graphene_matrix_multiply() with @m as the first argument.
+ *
+ * Since: 1.4
+ */
+void
+graphene_transform_builder_transform (graphene_transform_builder_t *b,
+                                      const graphene_matrix_t      *m)
+{
+  transform_op_t *op = transform_builder_add_op (b, TRANSFORM_OP_MATRIX);
+
+  graphene_matrix_to_float (m, op->v);
+}
+
+/**
+ * graphene_transform_builder_get_n_ops:
+ * @b: a #graphene_transform_builder_t
+ *
+ * Retrieves the number of operations recorded by @b, after merging
+ * the consecutive operations of the same kind.
+ *
+ * Returns: the number of operations
+ *
+ * Since: 1.4
+ */
+unsigned int
+graphene_transform_builder_get_n_ops (const graphene_transform_builder_t *b)
+{
+  return b->n_ops;
+}
+
+/**
+ * graphene_transform_builder_to_matrix:
+ * @b: a #graphene_transform_builder_t
+ * @res: (out caller-allocates): return location for the matrix
+ *
+ * Composes the transformations recorded by @b into a matrix.
+ *
+ * If no transformation was recorded, @res is set to the identity matrix.
+ *
+ * Since: 1.4
+ */
+void
+graphene_transform_builder_to_matrix (const graphene_transform_builder_t *b,
+                                      graphene_matrix_t                  *res)
+{
+  graphene_simd4x4f_t m;
+  unsigned int i;
+
+  graphene_simd4x4f_init_identity (&m);
+
+  for (i = 0; i < b->n_ops; i++)
+    {
+      const transform_op_t *op = &b->ops[i];
+
+      switch (op->type)
+        {
+        case TRANSFORM_OP_TRANSLATE:
+          graphene_matrix_translate_internal (&m, graphene_simd4f_init_4f (op->v));
+          break;
+
+        case TRANSFORM_OP_SCALE:
+          graphene_matrix_scale_internal (&m, op->v[0], op->v[1], op->v[2]);
+          break;
+
+        case TRANSFORM_OP_ROTATE:
+          graphene_matrix_rotate_internal (&m, op->v[3], graphene_simd4f_init_3f (op->v));
+          break;
+
+        case TRANSFORM_OP_ROTATE_X:
+          graphene_matrix_rotate_x_internal (&m, op->v[3]);
+          break;
+
+        case TRANSFORM_OP_ROTATE_Y:
+          graphene_matrix_rotate_y_internal (&m, op->v[3]);
+          break;
+
+        case TRANSFORM_OP_ROTATE_Z:
+          graphene_matrix_rotate_z_internal (&m, op->v[3]);
+          break;
+
+        case TRANSFORM_OP_MATRIX:
+          {
+            graphene_simd4x4f_t op_m;
+
+            graphene_simd4x4f_init_from_float (&op_m, op->v);
+            graphene_simd4x4f_matrix_mul (&op_m, &m, &m);
+          }
+          break;
+        }
+    }
+
+  res->value = m;
+}
@@ -0,0 +1,70 @@
+/* graphene-transform-builder.h: Transformation builder
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_TRANSFORM_BUILDER_H__
+#define __GRAPHENE_TRANSFORM_BUILDER_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-matrix.h"
+#include "graphene-point3d.h"
+#include "graphene-vec3.h"
+
+GRAPHENE_BEGIN_DECLS
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_transform_builder_t *  graphene_transform_builder_alloc        (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_transform_builder_free         (graphene_transform_builder_t *b);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_transform_builder_t *  graphene_transform_builder_init         (graphene_transform_builder_t *b);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_transform_builder_translate    (graphene_transform_builder_t *b,
+                                                                         const graphene_point3d_t     *pos);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_transform_builder_scale        (graphene_transform_builder_t *b,
+                                                                         float                         factor_x,
+                                                                         float                         factor_y,
+                                                                         float                         factor_z);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_transform_builder_rotate       (graphene_transform_builder_t *b,
+                                                                         float                         angle,
+                                                                         const graphene_vec3_t        *axis);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_transform_builder_transform    (graphene_transform_builder_t *b,
+                                                                         const graphene_matrix_t      *m);
+
+GRAPHENE_AVAILABLE_IN_1_4
+unsigned int                    graphene_transform_builder_get_n_ops    (const graphene_transform_builder_t *b);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_transform_builder_to_matrix    (const graphene_transform_builder_t *b,
+                                                                         graphene_matrix_t                  *res);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_TRANSFORM_BUILDER_H__ */
@@ -66,14 +66,21 @@ typedef struct _graphene_vec3_t         graphene_vec3_t;
 typedef struct _graphene_vec4_t         graphene_vec4_t;
 
 typedef struct _graphene_matrix_t       graphene_matrix_t;
+typedef struct _graphene_matrix_interpolator_t graphene_matrix_interpolator_t;
+typedef struct _graphene_matrix3x4_t    graphene_matrix3x4_t;
+typedef struct _graphene_matrix_stack_t graphene_matrix_stack_t;
 
 typedef struct _graphene_point_t        graphene_point_t;
 typedef struct _graphene_size_t         graphene_size_t;
 typedef struct _graphene_rect_t         graphene_rect_t;
 
 typedef struct _graphene_point3d_t      graphene_point3d_t;
+typedef struct _graphene_line_segment_t graphene_line_segment_t;
+
 typedef struct _graphene_quad_t         graphene_quad_t;
+typedef struct _graphene_prepared_quad_t graphene_prepared_quad_t;
 typedef struct _graphene_quaternion_t   graphene_quaternion_t;
+typedef struct _graphene_dual_quaternion_t graphene_dual_quaternion_t;
 typedef struct _graphene_euler_t        graphene_euler_t;
 
 typedef struct _graphene_plane_t        graphene_plane_t;
@@ -82,6 +89,18 @@ typedef struct _graphene_sphere_t       graphene_sphere_t;
 typedef struct _graphene_box_t          graphene_box_t;
 typedef struct _graphene_triangle_t     graphene_triangle_t;
 typedef struct _graphene_ray_t          graphene_ray_t;
+typedef struct _graphene_polygon_t      graphene_polygon_t;
+
+typedef struct _graphene_tile_binner_t  graphene_tile_binner_t;
+
+typedef struct _graphene_track_t        graphene_track_t;
+typedef struct _graphene_track_cursor_t graphene_track_cursor_t;
+
+typedef struct _graphene_transform_builder_t graphene_transform_builder_t;
+
+typedef struct _graphene_unprojector_t   graphene_unprojector_t;
+
+typedef struct _graphene_skin_vertices_t graphene_skin_vertices_t;
 
 GRAPHENE_END_DECLS
 
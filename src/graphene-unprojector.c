@@ -0,0 +1,274 @@
+/* graphene-unprojector.c: Cached unprojection
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-unprojector
+ * @Title: Unprojector
+ * @Short_Description: Unprojection of points and picking rays
+ *
+ * #graphene_unprojector_t caches the transformation used by
+ * graphene_matrix_unproject_point3d(), that is the inverse of the
+ * projection matrix multiplied by the modelview matrix, so that it
+ * can be used to unproject any number of points without inverting
+ * the projection matrix every time.
+ *
+ * The points to unproject are in normalized device coordinates, with
+ * all three components in the [-1, 1] range; for instance, the values
+ * read from a depth buffer can be converted into view or world space
+ * coordinates using graphene_unprojector_unproject_points(), and the
+ * picking ray under the pointer can be computed using
+ * graphene_unprojector_get_ray().
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-unprojector.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+/**
+ * graphene_unprojector_alloc: (constructor)
+ *
+ * Allocates a new #graphene_unprojector_t.
+ *
+ * The contents of the returned structure are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_unprojector_t.
+ *   Use graphene_unprojector_free() to free the resources allocated
+ *   by this function
+ *
+ * Since: 1.4
+ */
+graphene_unprojector_t *
+graphene_unprojector_alloc (void)
+{
+  return graphene_aligned_alloc (sizeof (graphene_unprojector_t), 1, 16);
+}
+
+/**
+ * graphene_unprojector_free:
+ * @u: a #graphene_unprojector_t
+ *
+ * Frees the resources allocated by graphene_unprojector_alloc().
+ *
+ * Since: 1.4
+ */
+void
+graphene_unprojector_free (graphene_unprojector_t *u)
+{
+  graphene_aligned_free (u);
+}
+
+/**
+ * graphene_unprojector_init:
+ * @u: the #graphene_unprojector_t to initialize
+ * @projection: a #graphene_matrix_t for the projection matrix
+ * @modelview: a #graphene_matrix_t for the modelview matrix; this is
+ *   the inverse of the modelview used when projecting the points
+ *
+ * Initializes a #graphene_unprojector_t by inverting the @projection
+ * matrix and multiplying it with the @modelview matrix.
+ *
+ * If the @projection matrix cannot be inverted, the unprojector will
+ * return the points unchanged; you can use
+ * graphene_unprojector_is_valid() to check for this case.
+ *
+ * Returns: (transfer none): the initialized unprojector
+ *
+ * Since: 1.4
+ */
+graphene_unprojector_t *
+graphene_unprojector_init (graphene_unprojector_t  *u,
+                           const graphene_matrix_t *projection,
+                           const graphene_matrix_t *modelview)
+{
+  u->is_valid = graphene_simd4x4f_inverse (&projection->value, &u->value);
+
+  if (u->is_valid)
+    graphene_simd4x4f_matrix_mul (&u->value, &modelview->value, &u->value);
+  else
+    graphene_simd4x4f_init_identity (&u->value);
+
+  return u;
+}
+
+/**
+ * graphene_unprojector_is_valid:
+ * @u: a #graphene_unprojector_t
+ *
+ * Checks whether the projection matrix used to initialize @u
+ * could be inverted.
+ *
+ * Returns: `true` if the unprojector is valid
+ *
+ * Since: 1.4
+ */
+bool
+graphene_unprojector_is_valid (const graphene_unprojector_t *u)
+{
+  return u->is_valid;
+}
+
+static inline graphene_simd4f_t
+unprojector_transform (const graphene_unprojector_t *u,
+                       graphene_simd4f_t             v)
+{
+  graphene_simd4x4f_vec4_mul (&u->value, &v, &v);
+
+  return graphene_simd4f_div (v, graphene_simd4f_splat_w (v));
+}
+
+/**
+ * graphene_unprojector_unproject_point3d:
+ * @u: a #graphene_unprojector_t
+ * @point: a #graphene_point3d_t with the coordinates of the point
+ * @res: (out caller-allocates): return location for the unprojected
+ *   point
+ *
+ * Unprojects the given @point; the result is the same as calling
+ * graphene_matrix_unproject_point3d() with the matrices used to
+ * initialize @u.
+ *
+ * Since: 1.4
+ */
+void
+graphene_unprojector_unproject_point3d (const graphene_unprojector_t *u,
+                                        const graphene_point3d_t     *point,
+                                        graphene_point3d_t           *res)
+{
+  graphene_simd4f_t v;
+  float values[4];
+
+  v = graphene_simd4f_init (point->x, point->y, point->z, 1.f);
+  v = unprojector_transform (u, v);
+
+  graphene_simd4f_dup_4f (v, values);
+  graphene_point3d_init (res, values[0], values[1], values[2]);
+}
+
+/**
+ * graphene_unprojector_unproject_points:
+ * @u: a #graphene_unprojector_t
+ * @n_points: the number of points to unproject
+ * @points: (array length=n_points): the points to unproject
+ * @res: (out caller-allocates) (array length=n_points): return location
+ *   for the unprojected points
+ *
+ * Unprojects an array of points.
+ *
+ * The points are processed in groups of four, with each component of
+ * the four points held in a vector, so that the perspective division
+ * is performed once for each group.
+ *
+ * The @points and @res arrays can be the same.
+ *
+ * Since: 1.4
+ */
+void
+graphene_unprojector_unproject_points (const graphene_unprojector_t *u,
+                                       unsigned int                  n_points,
+                                       const graphene_point3d_t      points[],
+                                       graphene_point3d_t            res[])
+{
+  graphene_simd4f_t m[4][4];
+  const graphene_simd4f_t rows[4] = { u->value.x, u->value.y, u->value.z, u->value.w };
+  unsigned int i, j;
+
+  /* m[j][c] contains the coefficient of the j-th input component
+   * for the c-th output component in all four lanes
+   */
+  for (j = 0; j < 4; j++)
+    {
+      m[j][0] = graphene_simd4f_splat_x (rows[j]);
+      m[j][1] = graphene_simd4f_splat_y (rows[j]);
+      m[j][2] = graphene_simd4f_splat_z (rows[j]);
+      m[j][3] = graphene_simd4f_splat_w (rows[j]);
+    }
+
+  for (i = 0; i + 4 <= n_points; i += 4)
+    {
+      const graphene_point3d_t *p = points + i;
+      graphene_simd4f_t x, y, z, v[4], inv_w;
+      float values[3][4];
+
+      x = graphene_simd4f_init (p[0].x, p[1].x, p[2].x, p[3].x);
+      y = graphene_simd4f_init (p[0].y, p[1].y, p[2].y, p[3].y);
+      z = graphene_simd4f_init (p[0].z, p[1].z, p[2].z, p[3].z);
+
+      for (j = 0; j < 4; j++)
+        {
+          v[j] = graphene_simd4f_madd (x, m[0][j], m[3][j]);
+          v[j] = graphene_simd4f_madd (y, m[1][j], v[j]);
+          v[j] = graphene_simd4f_madd (z, m[2][j], v[j]);
+        }
+
+      inv_w = graphene_simd4f_div (graphene_simd4f_splat (1.f), v[3]);
+
+      for (j = 0; j < 3; j++)
+        {
+          v[j] = graphene_simd4f_mul (v[j], inv_w);
+          graphene_simd4f_dup_4f (v[j], values[j]);
+        }
+
+      for (j = 0; j < 4; j++)
+        graphene_point3d_init (&res[i + j], values[0][j], values[1][j], values[2][j]);
+    }
+
+  for (; i < n_points; i++)
+    graphene_unprojector_unproject_point3d (u, &points[i], &res[i]);
+}
+
+/**
+ * graphene_unprojector_get_ray:
+ * @u: a #graphene_unprojector_t
+ * @point: a #graphene_point_t with the normalized device coordinates
+ *   of the point
+ * @res: (out caller-allocates): return location for the ray
+ *
+ * Computes the ray going through the given @point, for instance
+ * to pick the objects under the pointer.
+ *
+ * The origin of the ray is the unprojection of @point on the near
+ * plane, and its direction goes towards the unprojection of @point
+ * on the far plane.
+ *
+ * Since: 1.4
+ */
+void
+graphene_unprojector_get_ray (const graphene_unprojector_t *u,
+                              const graphene_point_t       *point,
+                              graphene_ray_t               *res)
+{
+  graphene_simd4f_t p_near, p_far;
+  graphene_vec3_t origin, direction;
+
+  p_near = unprojector_transform (u, graphene_simd4f_init (point->x, point->y, -1.f, 1.f));
+  p_far = unprojector_transform (u, graphene_simd4f_init (point->x, point->y, 1.f, 1.f));
+
+  origin.value = graphene_simd4f_zero_w (p_near);
+  direction.value = graphene_simd4f_zero_w (graphene_simd4f_sub (p_far, p_near));
+
+  graphene_ray_init_from_vec3 (res, &origin, &direction);
+}
@@ -0,0 +1,85 @@
+/* graphene-unprojector.h: Cached unprojection
+ *
+ * Copyright 2026  agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __GRAPHENE_UNPROJECTOR_H__
+#define __GRAPHENE_UNPROJECTOR_H__
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-matrix.h"
+#include "graphene-point.h"
+#include "graphene-point3d.h"
+#include "graphene-ray.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_unprojector_t:
+ *
+ * A structure caching the transformation used to unproject points
+ * from normalized device coordinates; see graphene_unprojector_init().
+ *
+ * The contents of the #graphene_unprojector_t structure are private
+ * and should never be accessed directly.
+ *
+ * Since: 1.4
+ */
+struct _graphene_unprojector_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4x4f_t, value);
+  GRAPHENE_PRIVATE_FIELD (bool, is_valid);
+};
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_unprojector_t *        graphene_unprojector_alloc              (void);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_unprojector_free               (graphene_unprojector_t   *u);
+
+GRAPHENE_AVAILABLE_IN_1_4
+graphene_unprojector_t *        graphene_unprojector_init               (graphene_unprojector_t   *u,
+                                                                         const graphene_matrix_t  *projection,
+                                                                         const graphene_matrix_t  *modelview);
+GRAPHENE_AVAILABLE_IN_1_4
+bool                            graphene_unprojector_is_valid           (const graphene_unprojector_t *u);
+
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_unprojector_unproject_point3d  (const graphene_unprojector_t *u,
+                                                                         const graphene_point3d_t *point,
+                                                                         graphene_point3d_t       *res);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_unprojector_unproject_points   (const graphene_unprojector_t *u,
+                                                                         unsigned int              n_points,
+                                                                         const graphene_point3d_t  points[],
+                                                                         graphene_point3d_t        res[]);
+GRAPHENE_AVAILABLE_IN_1_4
+void                            graphene_unprojector_get_ray            (const graphene_unprojector_t *u,
+                                                                         const graphene_point_t   *point,
+                                                                         graphene_ray_t           *res);
+
+GRAPHENE_END_DECLS
+
+#endif /* __GRAPHENE_UNPROJECTOR_H__ */
@@ -40,14 +40,18 @@
 #include "graphene-vec4.h"
 
 #include "graphene-matrix.h"
+#include "graphene-matrix3x4.h"
 
 #include "graphene-point.h"
 #include "graphene-size.h"
 #include "graphene-rect.h"
+#include "graphene-line-segment.h"
 
 #include "graphene-point3d.h"
 #include "graphene-quad.h"
+#include "graphene-polygon.h"
 #include "graphene-quaternion.h"
+#include "graphene-dual-quaternion.h"
 #include "graphene-euler.h"
 #include "graphene-plane.h"
 #include "graphene-frustum.h"
@@ -56,6 +60,14 @@
 #include "graphene-triangle.h"
 #include "graphene-ray.h"
 
+#include "graphene-buffer.h"
+#include "graphene-tile-binner.h"
+#include "graphene-track.h"
+#include "graphene-transform-builder.h"
+#include "graphene-matrix-stack.h"
+#include "graphene-unprojector.h"
+#include "graphene-skin.h"
+
 #undef GRAPHENE_H_INSIDE
 
 #endif /* __GRAPHENE_H__ */
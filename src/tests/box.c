@@ -143,6 +143,29 @@ GRAPHENE_TEST_UNIT_BEGIN (box_equal)
 }
 GRAPHENE_TEST_UNIT_END
 
+GRAPHENE_TEST_UNIT_BEGIN (box_hash)
+{
+  graphene_point3d_t min = GRAPHENE_POINT3D_INIT (-0.f, -0.f, -0.f);
+  graphene_point3d_t max = GRAPHENE_POINT3D_INIT (0.f, 0.f, 0.f);
+  graphene_box_t b;
+
+  graphene_box_init (&b, &min, &max);
+  g_assert_true (graphene_box_equal (&b, graphene_box_zero ()));
+  g_assert_true (graphene_box_exact_equal (&b, graphene_box_zero ()));
+  g_assert_cmpuint (graphene_box_hash (&b), ==, graphene_box_hash (graphene_box_zero ()));
+
+  g_assert_cmpuint (graphene_box_hash (graphene_box_zero ()), !=, graphene_box_hash (graphene_box_one ()));
+  g_assert_cmpuint (graphene_box_hash (graphene_box_one ()), !=, graphene_box_hash (graphene_box_minus_one ()));
+
+  /* nearly equal boxes are not exactly equal */
+  graphene_point3d_init (&max, 0.f, 0.f, 0.00000001f);
+  graphene_box_init (&b, &min, &max);
+  g_assert_true (graphene_box_equal (&b, graphene_box_zero ()));
+  g_assert_false (graphene_box_exact_equal (&b, graphene_box_zero ()));
+  g_assert_false (graphene_box_exact_equal (&b, NULL));
+}
+GRAPHENE_TEST_UNIT_END
+
 GRAPHENE_TEST_UNIT_BEGIN (box_union)
 {
   graphene_box_t res;
@@ -293,6 +316,7 @@ GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/box/size", box_size)
   GRAPHENE_TEST_UNIT ("/box/center", box_center)
   GRAPHENE_TEST_UNIT ("/box/equal", box_equal)
+  GRAPHENE_TEST_UNIT ("/box/hash", box_hash)
   GRAPHENE_TEST_UNIT ("/box/union", box_union)
   GRAPHENE_TEST_UNIT ("/box/intersection", box_intersection)
   GRAPHENE_TEST_UNIT ("/box/expand/by-point", box_expand_by_point)
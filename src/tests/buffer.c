@@ -0,0 +1,171 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (buffer_matrices)
+{
+  graphene_matrix_t m[2];
+  graphene_point3d_t p;
+  float values[16], buffer[32];
+  unsigned int i, j;
+
+  graphene_matrix_init_translate (&m[0], graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_matrix_rotate (&m[0], 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_init_perspective (&m[1], 60.f, 1.5f, 1.f, 100.f);
+
+  g_assert_cmpint (graphene_buffer_pack_matrices (GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR, 2, m, buffer), ==, 32);
+  for (i = 0; i < 2; i++)
+    {
+      graphene_matrix_to_float (&m[i], values);
+      for (j = 0; j < 16; j++)
+        g_assert_cmpfloat (buffer[i * 16 + j], ==, values[j]);
+    }
+
+  g_assert_cmpint (graphene_buffer_pack_matrices (GRAPHENE_BUFFER_LAYOUT_COLUMN_MAJOR, 2, m, buffer), ==, 32);
+  for (i = 0; i < 2; i++)
+    {
+      graphene_matrix_to_float (&m[i], values);
+      for (j = 0; j < 16; j++)
+        g_assert_cmpfloat (buffer[i * 16 + (j % 4) * 4 + j / 4], ==, values[j]);
+    }
+
+  /* std140 and std430 store a mat4 by column */
+  g_assert_cmpint (graphene_buffer_pack_matrices (GRAPHENE_BUFFER_LAYOUT_STD140, 1, m, buffer), ==, 16);
+  graphene_buffer_pack_matrices (GRAPHENE_BUFFER_LAYOUT_STD430, 1, m, buffer + 16);
+  graphene_matrix_to_float (&m[0], values);
+  for (j = 0; j < 16; j++)
+    {
+      g_assert_cmpfloat (buffer[(j % 4) * 4 + j / 4], ==, values[j]);
+      g_assert_cmpfloat (buffer[16 + (j % 4) * 4 + j / 4], ==, values[j]);
+    }
+
+  /* the 3x4 layout drops the last column */
+  g_assert_cmpint (graphene_buffer_pack_matrices (GRAPHENE_BUFFER_LAYOUT_3X4, 2, m, buffer), ==, 24);
+  for (i = 0; i < 2; i++)
+    {
+      graphene_matrix_to_float (&m[i], values);
+      for (j = 0; j < 12; j++)
+        g_assert_cmpfloat (buffer[i * 12 + j], ==, values[(j % 4) * 4 + j / 4]);
+    }
+
+  /* the translation ends up in the last value of each row */
+  g_assert_cmpfloat (buffer[3], ==, 1.f);
+  g_assert_cmpfloat (buffer[7], ==, 2.f);
+  g_assert_cmpfloat (buffer[11], ==, 3.f);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (buffer_matrices3x4)
+{
+  const graphene_buffer_layout_t layouts[] = {
+    GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR,
+    GRAPHENE_BUFFER_LAYOUT_COLUMN_MAJOR,
+    GRAPHENE_BUFFER_LAYOUT_3X4,
+    GRAPHENE_BUFFER_LAYOUT_STD140,
+  };
+  graphene_matrix_t m[2];
+  graphene_matrix3x4_t m3x4[2];
+  graphene_point3d_t p;
+  float buffer[32], check[32];
+  unsigned int i, j, n_values;
+
+  graphene_matrix_init_translate (&m[0], graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_matrix_rotate (&m[0], 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_init_scale (&m[1], 2.f, 3.f, 4.f);
+  graphene_matrix_skew_xy (&m[1], 0.5f);
+
+  for (i = 0; i < 2; i++)
+    graphene_matrix3x4_init_from_matrix (&m3x4[i], &m[i]);
+
+  /* the same values as the affine matrices */
+  for (i = 0; i < G_N_ELEMENTS (layouts); i++)
+    {
+      n_values = graphene_buffer_pack_matrices (layouts[i], 2, m, check);
+      g_assert_cmpint (graphene_buffer_pack_matrices3x4 (layouts[i], 2, m3x4, buffer), ==, n_values);
+
+      for (j = 0; j < n_values; j++)
+        g_assert_cmpfloat (buffer[j], ==, check[j]);
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (buffer_matrices_stream)
+{
+  const unsigned int n_matrices = 8192;
+  graphene_matrix_t *m;
+  graphene_point3d_t p;
+  float *buffer, values[16];
+  unsigned int i, j;
+
+  m = g_new (graphene_matrix_t, n_matrices);
+  buffer = g_new (float, n_matrices * 16);
+
+  for (i = 0; i < n_matrices; i++)
+    graphene_matrix_init_translate (&m[i], graphene_point3d_init (&p, i, -1.f * i, 0.5f * i));
+
+  /* large enough for non-temporal stores into an aligned buffer */
+  g_assert_cmpint (graphene_buffer_pack_matrices (GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR, n_matrices, m, buffer), ==, n_matrices * 16);
+
+  for (i = 0; i < n_matrices; i++)
+    {
+      graphene_matrix_to_float (&m[i], values);
+      for (j = 0; j < 16; j++)
+        g_assert_cmpfloat (buffer[i * 16 + j], ==, values[j]);
+    }
+
+  g_free (buffer);
+  g_free (m);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (buffer_boxes)
+{
+  graphene_box_t b[2];
+  graphene_point3d_t min, max;
+  float buffer[16];
+
+  graphene_box_init (&b[0], graphene_point3d_init (&min, -1.f, -2.f, -3.f), graphene_point3d_init (&max, 1.f, 2.f, 3.f));
+  graphene_box_init (&b[1], graphene_point3d_init (&min, 4.f, 5.f, 6.f), graphene_point3d_init (&max, 7.f, 8.f, 9.f));
+
+  g_assert_cmpint (graphene_buffer_pack_boxes (GRAPHENE_BUFFER_LAYOUT_ROW_MAJOR, 2, b, buffer), ==, 12);
+  g_assert_cmpfloat (buffer[0], ==, -1.f);
+  g_assert_cmpfloat (buffer[5], ==, 3.f);
+  g_assert_cmpfloat (buffer[6], ==, 4.f);
+  g_assert_cmpfloat (buffer[11], ==, 9.f);
+
+  /* each vector is padded to four values */
+  g_assert_cmpint (graphene_buffer_pack_boxes (GRAPHENE_BUFFER_LAYOUT_STD140, 2, b, buffer), ==, 16);
+  g_assert_cmpfloat (buffer[2], ==, -3.f);
+  g_assert_cmpfloat (buffer[3], ==, 0.f);
+  g_assert_cmpfloat (buffer[4], ==, 1.f);
+  g_assert_cmpfloat (buffer[7], ==, 0.f);
+  g_assert_cmpfloat (buffer[8], ==, 4.f);
+  g_assert_cmpfloat (buffer[14], ==, 9.f);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (buffer_spheres)
+{
+  graphene_sphere_t s[2];
+  graphene_point3d_t center;
+  float buffer[8];
+
+  graphene_sphere_init (&s[0], graphene_point3d_init (&center, 1.f, 2.f, 3.f), 4.f);
+  graphene_sphere_init (&s[1], graphene_point3d_init (&center, 5.f, 6.f, 7.f), 8.f);
+
+  g_assert_cmpint (graphene_buffer_pack_spheres (GRAPHENE_BUFFER_LAYOUT_STD430, 2, s, buffer), ==, 8);
+  g_assert_cmpfloat (buffer[0], ==, 1.f);
+  g_assert_cmpfloat (buffer[3], ==, 4.f);
+  g_assert_cmpfloat (buffer[4], ==, 5.f);
+  g_assert_cmpfloat (buffer[7], ==, 8.f);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/buffer/matrices", buffer_matrices)
+  GRAPHENE_TEST_UNIT ("/buffer/matrices/stream", buffer_matrices_stream)
+  GRAPHENE_TEST_UNIT ("/buffer/matrices3x4", buffer_matrices3x4)
+  GRAPHENE_TEST_UNIT ("/buffer/boxes", buffer_boxes)
+  GRAPHENE_TEST_UNIT ("/buffer/spheres", buffer_spheres)
+)
@@ -0,0 +1,132 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (dual_quaternion_init)
+{
+  graphene_dual_quaternion_t dq;
+  graphene_quaternion_t q, real;
+  graphene_matrix_t m, r, t, check;
+  graphene_point3d_t p;
+  graphene_vec3_t translation;
+
+  graphene_dual_quaternion_init_identity (&dq);
+  graphene_dual_quaternion_to_matrix (&dq, &m);
+  g_assert_true (graphene_matrix_is_identity (&m));
+
+  graphene_quaternion_init_from_angle_vec3 (&q, 90.f, graphene_vec3_z_axis ());
+  graphene_vec3_init (&translation, 1.f, 2.f, 3.f);
+  graphene_dual_quaternion_init_from_rotation (&dq, &q, &translation);
+
+  graphene_dual_quaternion_get_real (&dq, &real);
+  g_assert_true (graphene_quaternion_equal (&real, &q));
+
+  graphene_dual_quaternion_get_translation (&dq, &translation);
+  graphene_assert_fuzzy_vec3_equal (&translation, graphene_vec3_init (&translation, 1.f, 2.f, 3.f), 0.0001);
+
+  /* the rotation is applied before the translation */
+  graphene_matrix_init_rotate (&r, 90.f, graphene_vec3_z_axis ());
+  graphene_matrix_init_translate (&t, graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_matrix_multiply (&r, &t, &check);
+
+  graphene_dual_quaternion_to_matrix (&dq, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  graphene_dual_quaternion_transform_point3d (&dq, graphene_point3d_init (&p, 1.f, 0.f, 0.f), &p);
+  graphene_assert_fuzzy_equals (p.x, 1.f, 0.0001);
+  graphene_assert_fuzzy_equals (p.y, 3.f, 0.0001);
+  graphene_assert_fuzzy_equals (p.z, 3.f, 0.0001);
+
+  /* converting the matrix back gives the same transformation */
+  graphene_dual_quaternion_init_from_matrix (&dq, &check);
+  graphene_dual_quaternion_to_matrix (&dq, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  /* the scale is discarded when converting a matrix */
+  graphene_matrix_init_scale (&m, 2.f, 2.f, 2.f);
+  graphene_matrix_init_rotate (&r, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_multiply (&m, &r, &r);
+  graphene_matrix_multiply (&r, &t, &m);
+  graphene_dual_quaternion_init_from_matrix (&dq, &m);
+
+  graphene_matrix_init_rotate (&r, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_multiply (&r, &t, &check);
+  graphene_dual_quaternion_to_matrix (&dq, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  /* so is a non-uniform scale */
+  graphene_matrix_init_scale (&m, 3.f, 0.5f, 2.f);
+  graphene_matrix_multiply (&m, &check, &m);
+  graphene_dual_quaternion_init_from_matrix (&dq, &m);
+  graphene_dual_quaternion_to_matrix (&dq, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (dual_quaternion_multiply)
+{
+  graphene_dual_quaternion_t a, b, res;
+  graphene_quaternion_t q;
+  graphene_matrix_t m_a, m_b, m, check;
+  graphene_vec3_t t;
+
+  graphene_quaternion_init_from_angle_vec3 (&q, 30.f, graphene_vec3_x_axis ());
+  graphene_dual_quaternion_init_from_rotation (&a, &q, graphene_vec3_init (&t, 1.f, 0.f, -2.f));
+  graphene_quaternion_init_from_angle_vec3 (&q, 60.f, graphene_vec3_y_axis ());
+  graphene_dual_quaternion_init_from_rotation (&b, &q, graphene_vec3_init (&t, 0.f, 3.f, 1.f));
+
+  graphene_dual_quaternion_to_matrix (&a, &m_a);
+  graphene_dual_quaternion_to_matrix (&b, &m_b);
+  graphene_matrix_multiply (&m_b, &m_a, &check);
+
+  graphene_dual_quaternion_multiply (&a, &b, &res);
+  graphene_dual_quaternion_to_matrix (&res, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (dual_quaternion_blend)
+{
+  graphene_dual_quaternion_t dq[2], res;
+  graphene_quaternion_t q, real, dual;
+  const float weights[2] = { 0.5f, 0.5f };
+  graphene_vec4_t v;
+  graphene_vec3_t t;
+
+  graphene_dual_quaternion_init_identity (&dq[0]);
+  graphene_quaternion_init_from_angle_vec3 (&q, 90.f, graphene_vec3_z_axis ());
+  graphene_dual_quaternion_init_from_rotation (&dq[1], &q, graphene_vec3_init (&t, 2.f, 0.f, 0.f));
+
+  graphene_dual_quaternion_blend (2, dq, weights, &res);
+
+  graphene_quaternion_init_from_angle_vec3 (&q, 45.f, graphene_vec3_z_axis ());
+  graphene_dual_quaternion_get_real (&res, &real);
+  g_assert_true (graphene_quaternion_equal (&real, &q));
+
+  /* the blended translation follows the arc of the rotation */
+  graphene_dual_quaternion_get_translation (&res, &t);
+  graphene_assert_fuzzy_equals (graphene_vec3_length (&t), 1.f / cosf (GRAPHENE_PI / 8.f), 0.0001);
+
+  /* negating both parts describes the same transformation */
+  graphene_dual_quaternion_get_real (&dq[1], &real);
+  graphene_dual_quaternion_get_dual (&dq[1], &dual);
+  graphene_quaternion_to_vec4 (&real, &v);
+  graphene_vec4_negate (&v, &v);
+  graphene_quaternion_init_from_vec4 (&real, &v);
+  graphene_quaternion_to_vec4 (&dual, &v);
+  graphene_vec4_negate (&v, &v);
+  graphene_quaternion_init_from_vec4 (&dual, &v);
+  graphene_dual_quaternion_init (&dq[1], &real, &dual);
+
+  graphene_dual_quaternion_blend (2, dq, weights, &res);
+  graphene_dual_quaternion_get_real (&res, &real);
+  g_assert_true (graphene_quaternion_equal (&real, &q));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/dual-quaternion/init", dual_quaternion_init)
+  GRAPHENE_TEST_UNIT ("/dual-quaternion/multiply", dual_quaternion_multiply)
+  GRAPHENE_TEST_UNIT ("/dual-quaternion/blend", dual_quaternion_blend)
+)
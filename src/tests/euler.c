@@ -44,7 +44,95 @@ GRAPHENE_TEST_UNIT_BEGIN (euler_quaternion_roundtrip)
 }
 GRAPHENE_TEST_UNIT_END
 
+GRAPHENE_TEST_UNIT_BEGIN (euler_to_array)
+{
+  const graphene_euler_order_t orders[] = {
+    GRAPHENE_EULER_ORDER_XYZ,
+    GRAPHENE_EULER_ORDER_YZX,
+    GRAPHENE_EULER_ORDER_ZXY,
+    GRAPHENE_EULER_ORDER_XZY,
+    GRAPHENE_EULER_ORDER_YXZ,
+    GRAPHENE_EULER_ORDER_ZYX,
+  };
+  graphene_euler_t values[7];
+  graphene_matrix_t matrices[7], m;
+  graphene_quaternion_t quaternions[7], q;
+  unsigned int i, j;
+
+  for (i = 0; i < G_N_ELEMENTS (orders); i++)
+    {
+      for (j = 0; j < G_N_ELEMENTS (values); j++)
+        graphene_euler_init_with_order (&values[j],
+                                        -400.f + j * 135.f,
+                                        30.f * j,
+                                        1000.f - j * 290.f,
+                                        orders[i]);
+
+      /* a different order in the second group of elements */
+      if (i == 0)
+        graphene_euler_init_with_order (&values[5], 10.f, 20.f, 30.f, GRAPHENE_EULER_ORDER_ZYX);
+
+      graphene_euler_to_matrix_array (G_N_ELEMENTS (values), values, matrices);
+      graphene_euler_to_quaternion_array (G_N_ELEMENTS (values), values, quaternions);
+
+      for (j = 0; j < G_N_ELEMENTS (values); j++)
+        {
+          graphene_euler_to_matrix (&values[j], &m);
+          graphene_assert_fuzzy_matrix_equal (&matrices[j], &m, 0.0001);
+
+          graphene_quaternion_init_from_euler (&q, &values[j]);
+          g_assert_true (graphene_quaternion_equal (&quaternions[j], &q));
+        }
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (euler_from_matrix_array)
+{
+  const graphene_euler_order_t orders[] = {
+    GRAPHENE_EULER_ORDER_XYZ,
+    GRAPHENE_EULER_ORDER_YZX,
+    GRAPHENE_EULER_ORDER_ZXY,
+    GRAPHENE_EULER_ORDER_XZY,
+    GRAPHENE_EULER_ORDER_YXZ,
+    GRAPHENE_EULER_ORDER_ZYX,
+  };
+  graphene_euler_t values[7], res[7], e;
+  graphene_matrix_t matrices[7], m, check;
+  unsigned int i, j;
+
+  for (i = 0; i < G_N_ELEMENTS (orders); i++)
+    {
+      for (j = 0; j < G_N_ELEMENTS (values); j++)
+        graphene_euler_init_with_order (&values[j],
+                                        -170.f + j * 55.f,
+                                        80.f - j * 25.f,
+                                        45.f * j,
+                                        orders[i]);
+
+      /* the middle angle is ±90° in every order */
+      graphene_euler_init_with_order (&values[6], 90.f, 90.f, 90.f, orders[i]);
+
+      graphene_euler_to_matrix_array (G_N_ELEMENTS (values), values, matrices);
+      graphene_euler_init_from_matrix_array (G_N_ELEMENTS (values), matrices, orders[i], res);
+
+      for (j = 0; j < G_N_ELEMENTS (values); j++)
+        {
+          g_assert_cmpint (graphene_euler_get_order (&res[j]), ==, orders[i]);
+
+          /* compare the rotations, as the angles can differ by 2π */
+          graphene_euler_init_from_matrix (&e, &matrices[j], orders[i]);
+          graphene_euler_to_matrix (&e, &check);
+          graphene_euler_to_matrix (&res[j], &m);
+          graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+        }
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
 GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/euler/init", euler_init)
   GRAPHENE_TEST_UNIT ("/euler/quaternion-roundtrip", euler_quaternion_roundtrip)
+  GRAPHENE_TEST_UNIT ("/euler/to-array", euler_to_array)
+  GRAPHENE_TEST_UNIT ("/euler/from-matrix-array", euler_from_matrix_array)
 )
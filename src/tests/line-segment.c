@@ -0,0 +1,126 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (line_segment_init)
+{
+  graphene_line_segment_t *s;
+  graphene_point_t a, b, tmp;
+
+  graphene_point_init (&a, 1.f, 2.f);
+  graphene_point_init (&b, 3.f, 4.f);
+
+  s = graphene_line_segment_init (graphene_line_segment_alloc (), &a, &b);
+  graphene_line_segment_get_start (s, &tmp);
+  g_assert_true (graphene_point_equal (&tmp, &a));
+  graphene_line_segment_get_end (s, &tmp);
+  g_assert_true (graphene_point_equal (&tmp, &b));
+
+  graphene_line_segment_free (s);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (line_segment_intersection)
+{
+  graphene_line_segment_t s1, s2;
+  graphene_point_t a, b, res;
+
+  graphene_line_segment_init (&s1, graphene_point_init (&a, 0.f, 0.f), graphene_point_init (&b, 10.f, 10.f));
+
+  if (g_test_verbose ())
+    g_test_message ("Crossing segments...");
+  graphene_line_segment_init (&s2, graphene_point_init (&a, 0.f, 10.f), graphene_point_init (&b, 10.f, 0.f));
+  g_assert_true (graphene_line_segment_intersection (&s1, &s2, &res));
+  graphene_assert_fuzzy_equals (res.x, 5.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.y, 5.f, 0.0001);
+
+  if (g_test_verbose ())
+    g_test_message ("Touching segments...");
+  graphene_line_segment_init (&s2, graphene_point_init (&a, 10.f, 10.f), graphene_point_init (&b, 20.f, 0.f));
+  g_assert_true (graphene_line_segment_intersection (&s1, &s2, &res));
+  graphene_assert_fuzzy_equals (res.x, 10.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.y, 10.f, 0.0001);
+
+  if (g_test_verbose ())
+    g_test_message ("Disjoint segments...");
+  graphene_line_segment_init (&s2, graphene_point_init (&a, 6.f, 0.f), graphene_point_init (&b, 10.f, 4.f));
+  g_assert_false (graphene_line_segment_intersection (&s1, &s2, NULL));
+  graphene_line_segment_init (&s2, graphene_point_init (&a, 0.f, 30.f), graphene_point_init (&b, 30.f, 0.f));
+  g_assert_false (graphene_line_segment_intersection (&s1, &s2, NULL));
+
+  if (g_test_verbose ())
+    g_test_message ("Collinear segments...");
+  graphene_line_segment_init (&s2, graphene_point_init (&a, 15.f, 15.f), graphene_point_init (&b, 5.f, 5.f));
+  g_assert_true (graphene_line_segment_intersection (&s1, &s2, &res));
+  graphene_assert_fuzzy_equals (res.x, 5.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.y, 5.f, 0.0001);
+  graphene_line_segment_init (&s2, graphene_point_init (&a, 11.f, 11.f), graphene_point_init (&b, 20.f, 20.f));
+  g_assert_false (graphene_line_segment_intersection (&s1, &s2, NULL));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (line_segment_closest_point)
+{
+  graphene_line_segment_t s;
+  graphene_point_t a, b, p, res;
+
+  graphene_line_segment_init (&s, graphene_point_init (&a, 0.f, 0.f), graphene_point_init (&b, 10.f, 0.f));
+
+  graphene_line_segment_get_closest_point (&s, graphene_point_init (&p, 5.f, 3.f), &res);
+  graphene_assert_fuzzy_equals (res.x, 5.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.y, 0.f, 0.0001);
+  graphene_assert_fuzzy_equals (graphene_line_segment_get_distance_to_point (&s, &p), 3.f, 0.0001);
+
+  graphene_line_segment_get_closest_point (&s, graphene_point_init (&p, -3.f, 4.f), &res);
+  g_assert_true (graphene_point_equal (&res, &a));
+  graphene_assert_fuzzy_equals (graphene_line_segment_get_distance_to_point (&s, &p), 5.f, 0.0001);
+
+  graphene_line_segment_get_closest_point (&s, graphene_point_init (&p, 20.f, 0.f), &res);
+  g_assert_true (graphene_point_equal (&res, &b));
+  graphene_assert_fuzzy_equals (graphene_line_segment_get_distance_to_point (&s, &p), 10.f, 0.0001);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (line_segment_batch)
+{
+  graphene_line_segment_t s, segments[7];
+  graphene_point_t a, b, points[7];
+  bool res[7];
+  float distances[7];
+  unsigned int i;
+
+  graphene_line_segment_init (&s, graphene_point_init (&a, 0.f, 0.f), graphene_point_init (&b, 10.f, 0.f));
+
+  for (i = 0; i < 7; i++)
+    {
+      /* vertical segments, crossing the x axis only within [0, 10] */
+      graphene_line_segment_init (&segments[i],
+                                  graphene_point_init (&a, 3.f * i - 2.f, -1.f),
+                                  graphene_point_init (&b, 3.f * i - 2.f, 1.f));
+      graphene_point_init (&points[i], 3.f * i - 2.f, 1.f);
+    }
+
+  /* a collinear overlapping segment exercises the parallel fallback */
+  graphene_line_segment_init (&segments[2], graphene_point_init (&a, 5.f, 0.f), graphene_point_init (&b, 15.f, 0.f));
+
+  g_assert_cmpint (graphene_line_segment_intersect_segments (&s, 7, segments, res), ==, 4);
+  for (i = 0; i < 7; i++)
+    {
+      g_assert_true (res[i] == graphene_line_segment_intersection (&s, &segments[i], NULL));
+      if (i != 2)
+        g_assert_true (res[i] == (i >= 1 && i <= 4));
+    }
+
+  graphene_line_segment_get_distances_to_points (&s, 7, points, distances);
+  for (i = 0; i < 7; i++)
+    graphene_assert_fuzzy_equals (distances[i], graphene_line_segment_get_distance_to_point (&s, &points[i]), 0.0001);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/line-segment/init", line_segment_init)
+  GRAPHENE_TEST_UNIT ("/line-segment/intersection", line_segment_intersection)
+  GRAPHENE_TEST_UNIT ("/line-segment/closest-point", line_segment_closest_point)
+  GRAPHENE_TEST_UNIT ("/line-segment/batch", line_segment_batch)
+)
@@ -0,0 +1,145 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_stack_empty)
+{
+  graphene_matrix_stack_t *s;
+  graphene_matrix_t m;
+
+  s = graphene_matrix_stack_init (graphene_matrix_stack_alloc ());
+  g_assert_cmpint (graphene_matrix_stack_get_depth (s), ==, 0);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_IDENTITY);
+
+  graphene_matrix_stack_get_transform (s, &m);
+  g_assert_true (graphene_matrix_is_identity (&m));
+  g_assert_true (graphene_matrix_stack_get_inverse (s, &m));
+  g_assert_true (graphene_matrix_is_identity (&m));
+
+  /* the identity is never popped */
+  g_assert_false (graphene_matrix_stack_pop (s));
+  g_assert_cmpint (graphene_matrix_stack_get_depth (s), ==, 0);
+
+  graphene_matrix_stack_free (s);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_stack_translate)
+{
+  graphene_matrix_stack_t *s;
+  graphene_matrix_t m, check;
+  graphene_point3d_t p;
+
+  s = graphene_matrix_stack_init (graphene_matrix_stack_alloc ());
+
+  graphene_matrix_stack_push_translate (s, graphene_point3d_init (&p, 10.f, 20.f, 0.f));
+  graphene_matrix_stack_push_translate (s, graphene_point3d_init (&p, -5.f, 0.f, 3.f));
+  g_assert_cmpint (graphene_matrix_stack_get_depth (s), ==, 2);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_TRANSLATE);
+
+  graphene_matrix_stack_get_transform (s, &m);
+  graphene_matrix_init_translate (&check, graphene_point3d_init (&p, 5.f, 20.f, 3.f));
+  g_assert_true (graphene_matrix_exact_equal (&m, &check));
+
+  g_assert_true (graphene_matrix_stack_get_inverse (s, &m));
+  graphene_matrix_init_translate (&check, graphene_point3d_init (&p, -5.f, -20.f, -3.f));
+  g_assert_true (graphene_matrix_exact_equal (&m, &check));
+
+  /* translation matrices take the same path */
+  graphene_matrix_init_translate (&m, graphene_point3d_init (&p, 1.f, 1.f, 1.f));
+  graphene_matrix_stack_push_multiply (s, &m);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_TRANSLATE);
+  graphene_matrix_stack_get_transform (s, &m);
+  graphene_matrix_init_translate (&check, graphene_point3d_init (&p, 6.f, 21.f, 4.f));
+  g_assert_true (graphene_matrix_exact_equal (&m, &check));
+
+  g_assert_true (graphene_matrix_stack_pop (s));
+  g_assert_true (graphene_matrix_stack_pop (s));
+  graphene_matrix_stack_get_transform (s, &m);
+  graphene_matrix_init_translate (&check, graphene_point3d_init (&p, 10.f, 20.f, 0.f));
+  g_assert_true (graphene_matrix_exact_equal (&m, &check));
+
+  graphene_matrix_stack_free (s);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_stack_compose)
+{
+  graphene_matrix_stack_t *s;
+  graphene_matrix_t m, rot, persp, check, inv;
+  graphene_point3d_t p;
+  unsigned int i;
+
+  s = graphene_matrix_stack_init (graphene_matrix_stack_alloc ());
+
+  graphene_matrix_init_rotate (&rot, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_scale (&rot, 2.f, 2.f, 1.f);
+  graphene_matrix_init_perspective (&persp, 60.f, 1.f, 1.f, 100.f);
+
+  graphene_matrix_stack_push_translate (s, graphene_point3d_init (&p, 10.f, 20.f, 0.f));
+  graphene_matrix_stack_push_multiply (s, &rot);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_AFFINE);
+
+  /* the new transformation applies before the current one */
+  graphene_matrix_init_translate (&check, &p);
+  graphene_matrix_multiply (&rot, &check, &check);
+  graphene_matrix_stack_get_transform (s, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  g_assert_true (graphene_matrix_stack_get_inverse (s, &m));
+  graphene_matrix_inverse (&check, &inv);
+  graphene_assert_fuzzy_matrix_equal (&m, &inv, 0.0001);
+
+  /* the translation updates the cached inverse of the previous entry */
+  graphene_matrix_stack_push_translate (s, graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_matrix_init_translate (&m, &p);
+  graphene_matrix_multiply (&m, &check, &check);
+  graphene_matrix_stack_get_transform (s, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  g_assert_true (graphene_matrix_stack_get_inverse (s, &m));
+  graphene_matrix_inverse (&check, &inv);
+  graphene_assert_fuzzy_matrix_equal (&m, &inv, 0.0001);
+
+  graphene_matrix_stack_push_multiply (s, &persp);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_PROJECTIVE);
+  graphene_matrix_multiply (&persp, &check, &check);
+  graphene_matrix_stack_get_transform (s, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  /* identity matrices keep the current entry */
+  graphene_matrix_stack_push_multiply (s, graphene_matrix_init_identity (&m));
+  g_assert_cmpint (graphene_matrix_stack_get_depth (s), ==, 5);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_PROJECTIVE);
+  graphene_matrix_stack_get_transform (s, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  /* the storage grows while preserving the entries */
+  for (i = 0; i < 40; i++)
+    graphene_matrix_stack_push_translate (s, graphene_point3d_init (&p, 0.f, 0.f, 0.f));
+  for (i = 0; i < 42; i++)
+    g_assert_true (graphene_matrix_stack_pop (s));
+
+  g_assert_cmpint (graphene_matrix_stack_get_depth (s), ==, 3);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_AFFINE);
+
+  /* singular transformations have no inverse */
+  graphene_matrix_init_scale (&m, 1.f, 0.f, 1.f);
+  graphene_matrix_stack_push_multiply (s, &m);
+  g_assert_false (graphene_matrix_stack_get_inverse (s, &m));
+  g_assert_true (graphene_matrix_is_identity (&m));
+
+  graphene_matrix_stack_init (s);
+  g_assert_cmpint (graphene_matrix_stack_get_depth (s), ==, 0);
+  g_assert_cmpint (graphene_matrix_stack_get_transform_type (s), ==, GRAPHENE_TRANSFORM_IDENTITY);
+
+  graphene_matrix_stack_free (s);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/matrix-stack/empty", matrix_stack_empty)
+  GRAPHENE_TEST_UNIT ("/matrix-stack/translate", matrix_stack_translate)
+  GRAPHENE_TEST_UNIT ("/matrix-stack/compose", matrix_stack_compose)
+)
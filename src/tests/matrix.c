@@ -328,6 +328,233 @@ GRAPHENE_TEST_UNIT_BEGIN (matrix_look_at)
 }
 GRAPHENE_TEST_UNIT_END
 
+GRAPHENE_TEST_UNIT_BEGIN (matrix_invert_paths)
+{
+  graphene_matrix_t m[5], identity, inv, res;
+  graphene_point3d_t p;
+  graphene_vec3_t axis;
+  graphene_vec4_t v, t;
+  float f[16];
+  unsigned int i;
+
+  graphene_matrix_init_identity (&identity);
+
+  /* rigid */
+  graphene_matrix_init_rotate (&m[0], 30.f, graphene_vec3_init (&axis, 1.f, 2.f, 3.f));
+  graphene_matrix_rotate_y (&m[0], -75.f);
+  graphene_matrix_translate (&m[0], graphene_point3d_init (&p, 4.f, -5.f, 6.f));
+
+  /* scale and translation */
+  graphene_matrix_init_scale (&m[1], 2.f, -0.5f, 4.f);
+  graphene_matrix_translate (&m[1], graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+
+  /* affine */
+  graphene_matrix_init_rotate (&m[2], 30.f, graphene_vec3_init (&axis, 1.f, 2.f, 3.f));
+  graphene_matrix_skew_xy (&m[2], 0.5f);
+  graphene_matrix_scale (&m[2], 2.f, 3.f, -1.f);
+  graphene_matrix_translate (&m[2], graphene_point3d_init (&p, 4.f, -5.f, 6.f));
+
+  /* projective */
+  graphene_matrix_init_rotate (&m[3], 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_perspective (&m[3], 100.f, &m[3]);
+
+  /* a uniform scale is not a rotation */
+  graphene_matrix_init_rotate (&m[4], 45.f, graphene_vec3_z_axis ());
+  graphene_matrix_scale (&m[4], 2.f, 2.f, 2.f);
+
+  for (i = 0; i < G_N_ELEMENTS (m); i++)
+    {
+      g_assert_true (graphene_matrix_inverse (&m[i], &inv));
+      graphene_matrix_multiply (&m[i], &inv, &res);
+      graphene_assert_fuzzy_matrix_equal (&res, &identity, 0.0001f);
+
+      g_assert_true (graphene_matrix_inverse_affine (&m[i], &inv));
+      graphene_matrix_multiply (&m[i], &inv, &res);
+      graphene_assert_fuzzy_matrix_equal (&res, &identity, 0.0001f);
+
+      g_assert_true (graphene_matrix_inverse_rigid (&m[i], &inv));
+      graphene_matrix_multiply (&m[i], &inv, &res);
+      graphene_assert_fuzzy_matrix_equal (&res, &identity, 0.0001f);
+    }
+
+  /* a small perspective term is not dropped by the affine paths, as
+   * its effect depends on the coordinates it multiplies
+   */
+  graphene_matrix_to_float (&identity, f);
+  f[3] = 1e-7f;
+  graphene_matrix_init_from_float (&res, f);
+  g_assert_true (graphene_matrix_inverse (&res, &inv));
+
+  graphene_vec4_init (&v, 1e6f, 0.f, 0.f, 1.f);
+  graphene_matrix_transform_vec4 (&res, &v, &t);
+  graphene_assert_fuzzy_equals (graphene_vec4_get_w (&t), 1.1f, 0.0001f);
+  graphene_matrix_transform_vec4 (&inv, &t, &t);
+  graphene_assert_fuzzy_equals (graphene_vec4_get_x (&t), 1e6f, 1.f);
+  graphene_assert_fuzzy_equals (graphene_vec4_get_w (&t), 1.f, 0.0001f);
+
+  /* singular matrices are not inverted by any path */
+  graphene_matrix_init_scale (&m[0], 1.f, 0.f, 1.f);
+  graphene_matrix_init_rotate (&m[1], 30.f, graphene_vec3_x_axis ());
+  graphene_matrix_scale (&m[1], 1.f, 1.f, 0.f);
+
+  for (i = 0; i < 2; i++)
+    {
+      g_assert_false (graphene_matrix_inverse (&m[i], &inv));
+      g_assert_false (graphene_matrix_inverse_affine (&m[i], &inv));
+      g_assert_false (graphene_matrix_inverse_rigid (&m[i], &inv));
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_normal_matrix)
+{
+  graphene_matrix_t m[4], res[4], n, inv, check;
+  graphene_point3d_t p;
+  graphene_vec3_t axis;
+  unsigned int i;
+
+  /* rigid */
+  graphene_matrix_init_rotate (&m[0], 30.f, graphene_vec3_init (&axis, 1.f, 2.f, 3.f));
+  graphene_matrix_translate (&m[0], graphene_point3d_init (&p, 4.f, -5.f, 6.f));
+
+  /* uniform scale */
+  graphene_matrix_init_rotate (&m[1], -45.f, graphene_vec3_y_axis ());
+  graphene_matrix_scale (&m[1], 3.f, 3.f, 3.f);
+
+  /* non-uniform scale and shear */
+  graphene_matrix_init_rotate (&m[2], 60.f, &axis);
+  graphene_matrix_skew_xz (&m[2], 0.25f);
+  graphene_matrix_scale (&m[2], 2.f, -0.5f, 4.f);
+  graphene_matrix_translate (&m[2], &p);
+
+  /* singular */
+  graphene_matrix_init_scale (&m[3], 1.f, 0.f, 1.f);
+
+  for (i = 0; i < 3; i++)
+    {
+      graphene_matrix_t upper;
+      float f[16];
+
+      g_assert_true (graphene_matrix_get_normal_matrix (&m[i], &n));
+
+      /* the inverse transpose of the upper 3x3 component */
+      graphene_matrix_to_float (&m[i], f);
+      f[12] = f[13] = f[14] = 0.f;
+      f[15] = 1.f;
+      graphene_matrix_init_from_float (&upper, f);
+      g_assert_true (graphene_matrix_inverse (&upper, &inv));
+      graphene_matrix_transpose (&inv, &check);
+      graphene_assert_fuzzy_matrix_equal (&n, &check, 0.0001);
+    }
+
+  g_assert_false (graphene_matrix_get_normal_matrix (&m[3], &n));
+
+  g_assert_cmpint (graphene_matrix_get_normal_matrix_array (4, m, res), ==, 1);
+  for (i = 0; i < 3; i++)
+    {
+      graphene_matrix_get_normal_matrix (&m[i], &n);
+      graphene_assert_fuzzy_matrix_equal (&res[i], &n, 0.00001);
+    }
+
+  g_assert_true (graphene_matrix_is_identity (&res[3]));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_equal_hash)
+{
+  graphene_matrix_t m, n;
+  graphene_point3d_t p;
+  float v[16];
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_init_from_matrix (&n, &m);
+
+  g_assert_true (graphene_matrix_exact_equal (&m, &m));
+  g_assert_false (graphene_matrix_exact_equal (&m, NULL));
+  g_assert_false (graphene_matrix_exact_equal (NULL, &m));
+  g_assert_true (graphene_matrix_exact_equal (&m, &n));
+  g_assert_cmpuint (graphene_matrix_hash (&m), ==, graphene_matrix_hash (&n));
+
+  /* -0 and +0 are equal, and have the same hash */
+  graphene_matrix_init_identity (&m);
+  graphene_matrix_to_float (&m, v);
+  v[1] = v[4] = v[12] = -0.f;
+  graphene_matrix_init_from_float (&n, v);
+  g_assert_true (graphene_matrix_exact_equal (&m, &n));
+  g_assert_cmpuint (graphene_matrix_hash (&m), ==, graphene_matrix_hash (&n));
+
+  /* the equality is exact; the fuzzy check uses a threshold */
+  graphene_matrix_init_translate (&n, graphene_point3d_init (&p, 0.001f, 0.f, 0.f));
+  g_assert_false (graphene_matrix_exact_equal (&m, &n));
+  g_assert_true (graphene_matrix_near (&m, &n, 0.01f));
+  g_assert_false (graphene_matrix_near (&m, &n, 0.0001f));
+  g_assert_cmpuint (graphene_matrix_hash (&m), !=, graphene_matrix_hash (&n));
+
+  graphene_matrix_init_scale (&n, 1.f, 1.f, -1.f);
+  g_assert_false (graphene_matrix_exact_equal (&m, &n));
+  g_assert_false (graphene_matrix_near (&m, &n, 1.f));
+  g_assert_true (graphene_matrix_near (&m, &n, 2.f));
+  g_assert_cmpuint (graphene_matrix_hash (&m), !=, graphene_matrix_hash (&n));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_transform_box)
+{
+  graphene_matrix_t m;
+  graphene_box_t boxes[3], res[3], check;
+  graphene_point3d_t p, min, max;
+  graphene_vec3_t axis, vertices[8], a, b;
+  unsigned int i, j;
+
+  graphene_box_init (&boxes[0], graphene_point3d_init (&min, -1.f, -2.f, -3.f), graphene_point3d_init (&max, 1.f, 2.f, 3.f));
+  graphene_box_init (&boxes[1], graphene_point3d_init (&min, 2.f, 0.f, -1.f), graphene_point3d_init (&max, 5.f, 0.5f, 4.f));
+  graphene_box_init_from_box (&boxes[2], graphene_box_empty ());
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_init (&axis, 1.f, 2.f, 3.f));
+  graphene_matrix_skew_xy (&m, 0.5f);
+  graphene_matrix_scale (&m, 2.f, -0.5f, 3.f);
+  graphene_matrix_translate (&m, graphene_point3d_init (&p, 4.f, -5.f, 6.f));
+
+  graphene_matrix_transform_boxes (&m, 3, boxes, res);
+
+  /* the bounds of the transformed vertices */
+  for (i = 0; i < 2; i++)
+    {
+      graphene_box_get_vertices (&boxes[i], vertices);
+      for (j = 0; j < 8; j++)
+        {
+          graphene_point3d_init_from_vec3 (&p, &vertices[j]);
+          graphene_matrix_transform_point3d (&m, &p, &p);
+          graphene_point3d_to_vec3 (&p, &vertices[j]);
+        }
+
+      graphene_box_init_from_vectors (&check, 8, vertices);
+
+      graphene_box_get_min (&res[i], &min);
+      graphene_box_get_min (&check, &max);
+      graphene_point3d_to_vec3 (&min, &a);
+      graphene_point3d_to_vec3 (&max, &b);
+      graphene_assert_fuzzy_vec3_equal (&a, &b, 0.0001);
+      graphene_box_get_max (&res[i], &min);
+      graphene_box_get_max (&check, &max);
+      graphene_point3d_to_vec3 (&min, &a);
+      graphene_point3d_to_vec3 (&max, &b);
+      graphene_assert_fuzzy_vec3_equal (&a, &b, 0.0001);
+
+      graphene_matrix_transform_box (&m, &boxes[i], &check);
+      g_assert_true (graphene_box_equal (&res[i], &check));
+    }
+
+  g_assert_true (graphene_box_equal (&res[2], graphene_box_empty ()));
+
+  /* a projective matrix transforms the vertices */
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 10.f);
+  graphene_matrix_transform_boxes (&m, 1, &boxes[1], res);
+  graphene_matrix_transform_box (&m, &boxes[1], &check);
+  g_assert_true (graphene_box_equal (&res[0], &check));
+}
+GRAPHENE_TEST_UNIT_END
+
 GRAPHENE_TEST_UNIT_BEGIN (matrix_2d_identity)
 {
   graphene_matrix_t m1;
@@ -434,6 +661,258 @@ GRAPHENE_TEST_UNIT_BEGIN (matrix_2d_round_trip)
 }
 GRAPHENE_TEST_UNIT_END
 
+GRAPHENE_TEST_UNIT_BEGIN (matrix_axis_alignment)
+{
+  graphene_point3d_t t;
+  graphene_matrix_t m;
+
+  graphene_matrix_init_identity (&m);
+  g_assert_true (graphene_matrix_preserves_axis_alignment (&m));
+
+  graphene_matrix_init_scale (&m, 2.f, -3.f, 1.f);
+  graphene_matrix_translate (&m, graphene_point3d_init (&t, 10.f, 20.f, 0.f));
+  g_assert_true (graphene_matrix_preserves_axis_alignment (&m));
+
+  graphene_matrix_init_scale (&m, 100.f, 50.f, 1.f);
+  graphene_matrix_rotate_z (&m, 90.f);
+  g_assert_true (graphene_matrix_preserves_axis_alignment (&m));
+
+  graphene_matrix_init_rotate (&m, 45.f, graphene_vec3_z_axis ());
+  g_assert_false (graphene_matrix_preserves_axis_alignment (&m));
+
+  graphene_matrix_init_skew (&m, 0.5f, 0.f);
+  g_assert_false (graphene_matrix_preserves_axis_alignment (&m));
+
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 100.f);
+  g_assert_false (graphene_matrix_preserves_axis_alignment (&m));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_clip_rect)
+{
+  graphene_rect_t clip = GRAPHENE_RECT_INIT (0.f, 0.f, 100.f, 100.f);
+  graphene_rect_t r = GRAPHENE_RECT_INIT (0.f, 0.f, 20.f, 10.f);
+  graphene_rect_t res;
+  graphene_quad_t q;
+  graphene_point3d_t t, p3;
+  graphene_point_t p;
+  graphene_matrix_t m;
+
+  graphene_matrix_init_translate (&m, graphene_point3d_init (&t, 90.f, 50.f, 0.f));
+  graphene_matrix_scale (&m, 2.f, 2.f, 1.f);
+  g_assert_true (graphene_matrix_clip_rect (&m, &r, &clip, &res, NULL));
+  graphene_assert_fuzzy_equals (res.origin.x, 90.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.origin.y, 50.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.size.width, 10.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.size.height, 20.f, 0.0001);
+
+  graphene_matrix_init_translate (&m, graphene_point3d_init (&t, 50.f, 50.f, 0.f));
+  graphene_matrix_rotate_z (&m, 90.f);
+  g_assert_true (graphene_matrix_clip_rect (&m, &r, &clip, &res, NULL));
+  graphene_assert_fuzzy_equals (res.origin.x, 40.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.origin.y, 50.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.size.width, 10.f, 0.0001);
+  graphene_assert_fuzzy_equals (res.size.height, 20.f, 0.0001);
+
+  graphene_matrix_init_translate (&m, graphene_point3d_init (&t, 50.f, 50.f, 0.f));
+  graphene_matrix_rotate_z (&m, 45.f);
+  g_assert_false (graphene_matrix_clip_rect (&m, &r, &clip, &res, &q));
+  g_assert_true (graphene_rect_contains_rect (&clip, &res));
+
+  graphene_quad_bounds (&q, &r);
+  g_assert_true (graphene_rect_contains_rect (&r, &res));
+
+  graphene_matrix_transform_point3d (&m, graphene_point3d_init (&t, 10.f, 5.f, 0.f), &p3);
+  graphene_point_init (&p, p3.x, p3.y);
+  g_assert_true (graphene_quad_contains (&q, &p));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_interpolator)
+{
+  graphene_matrix_interpolator_t *i;
+  graphene_matrix_t a, b, res, check[4];
+  graphene_point3d_t t;
+  float factors[4] = { 0.f, 0.25f, 0.5f, 1.f };
+  unsigned int j;
+
+  graphene_matrix_init_identity (&a);
+  graphene_matrix_init_translate (&b, graphene_point3d_init (&t, 10.f, 20.f, 30.f));
+  graphene_matrix_scale (&b, 3.f, 3.f, 3.f);
+
+  i = graphene_matrix_interpolator_init (graphene_matrix_interpolator_alloc (), &a, &b);
+  g_assert_true (graphene_matrix_interpolator_is_valid (i));
+
+  graphene_matrix_interpolator_interpolate (i, 0.5, &res);
+  graphene_assert_fuzzy_equals (graphene_matrix_get_x_scale (&res), 2.f, 0.0001);
+  graphene_assert_fuzzy_equals (graphene_matrix_get_y_scale (&res), 2.f, 0.0001);
+  graphene_assert_fuzzy_equals (graphene_matrix_get_z_scale (&res), 2.f, 0.0001);
+  graphene_assert_fuzzy_equals (graphene_matrix_get_value (&res, 3, 0), 5.f, 0.0001);
+  graphene_assert_fuzzy_equals (graphene_matrix_get_value (&res, 3, 1), 10.f, 0.0001);
+  graphene_assert_fuzzy_equals (graphene_matrix_get_value (&res, 3, 2), 15.f, 0.0001);
+
+  graphene_matrix_rotate_z (&b, 90.f);
+  graphene_matrix_interpolator_init (i, &a, &b);
+  graphene_matrix_interpolator_interpolate_array (i, 4, factors, check);
+  for (j = 0; j < 4; j++)
+    {
+      graphene_matrix_interpolate (&a, &b, factors[j], &res);
+      graphene_assert_fuzzy_matrix_equal (&check[j], &res, 0.0001);
+    }
+
+  graphene_assert_fuzzy_matrix_equal (&check[0], &a, 0.01);
+  graphene_assert_fuzzy_matrix_equal (&check[3], &b, 0.01);
+
+  /* singular matrices cannot be decomposed */
+  graphene_matrix_init_scale (&b, 0.f, 1.f, 1.f);
+  graphene_matrix_interpolator_init (i, &a, &b);
+  g_assert_false (graphene_matrix_interpolator_is_valid (i));
+  graphene_matrix_interpolator_interpolate (i, 0.5, &res);
+  g_assert_true (graphene_matrix_is_identity (&res));
+
+  graphene_matrix_interpolator_free (i);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_2d_bounds)
+{
+  graphene_matrix_t m[4], persp;
+  graphene_rect_t rects[3], res[3], check, tmp;
+  graphene_quad_t q;
+  graphene_vec3_t axis;
+  unsigned int i, j;
+
+  graphene_rect_init (&rects[0], 10.f, 20.f, 100.f, 50.f);
+  graphene_rect_init (&rects[1], -5.f, 5.f, -20.f, -10.f);
+  graphene_rect_init (&rects[2], 0.f, 0.f, 0.f, 0.f);
+
+  graphene_matrix_init_scale (&m[0], 2.f, -3.f, 1.f);
+  graphene_matrix_init_rotate (&m[1], 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_skew_xy (&m[1], 0.5f);
+  graphene_matrix_init_rotate (&m[2], 60.f, graphene_vec3_init (&axis, 1.f, 2.f, 3.f));
+
+  graphene_matrix_init_perspective (&persp, 60.f, 1.f, 1.f, 100.f);
+  graphene_matrix_init_rotate (&m[3], 45.f, graphene_vec3_y_axis ());
+  graphene_matrix_multiply (&m[3], &persp, &m[3]);
+
+  for (i = 0; i < 4; i++)
+    {
+      /* the bounds of the transformed and projected quads */
+      graphene_matrix_transform_bounds_array (&m[i], 3, rects, res);
+      for (j = 0; j < 3; j++)
+        {
+          graphene_matrix_transform_rect (&m[i], &rects[j], &q);
+          graphene_quad_bounds (&q, &check);
+          graphene_assert_fuzzy_equals (res[j].origin.x, check.origin.x, 0.001);
+          graphene_assert_fuzzy_equals (res[j].origin.y, check.origin.y, 0.001);
+          graphene_assert_fuzzy_equals (res[j].size.width, check.size.width, 0.001);
+          graphene_assert_fuzzy_equals (res[j].size.height, check.size.height, 0.001);
+
+          graphene_matrix_transform_bounds (&m[i], &rects[j], &tmp);
+          g_assert_true (graphene_rect_equal (&res[j], &tmp));
+        }
+
+      graphene_matrix_project_rect_bounds_array (&m[i], 3, rects, res);
+      for (j = 0; j < 3; j++)
+        {
+          graphene_matrix_project_rect (&m[i], &rects[j], &q);
+          graphene_quad_bounds (&q, &check);
+          graphene_assert_fuzzy_equals (res[j].origin.x, check.origin.x, 0.001);
+          graphene_assert_fuzzy_equals (res[j].origin.y, check.origin.y, 0.001);
+          graphene_assert_fuzzy_equals (res[j].size.width, check.size.width, 0.001);
+          graphene_assert_fuzzy_equals (res[j].size.height, check.size.height, 0.001);
+
+          graphene_matrix_project_rect_bounds (&m[i], &rects[j], &tmp);
+          g_assert_true (graphene_rect_equal (&res[j], &tmp));
+        }
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix_decompose)
+{
+  graphene_matrix_t m, check, res;
+  graphene_matrix_interpolator_t i;
+  graphene_vec3_t translate, scale, shear, v;
+  graphene_vec4_t perspective, w;
+  graphene_quaternion_t rotate;
+  graphene_point3d_t t;
+
+  if (g_test_verbose ())
+    g_test_message ("Affine matrix...");
+  graphene_matrix_init_translate (&m, graphene_point3d_init (&t, 1.f, 2.f, 3.f));
+  graphene_matrix_rotate_x (&m, 90.f);
+  graphene_matrix_scale (&m, 2.f, 3.f, 4.f);
+
+  g_assert_true (graphene_matrix_decompose (&m, &translate, &scale, &rotate, &shear, &perspective));
+  graphene_assert_fuzzy_vec3_equal (&translate, graphene_vec3_init (&v, 1.f, 2.f, 3.f), 0.0001);
+  graphene_assert_fuzzy_vec3_equal (&scale, graphene_vec3_init (&v, 2.f, 3.f, 4.f), 0.0001);
+  graphene_assert_fuzzy_vec3_equal (&shear, graphene_vec3_zero (), 0.0001);
+  graphene_assert_fuzzy_vec4_equal (&perspective, graphene_vec4_w_axis (), 0.0001);
+
+  graphene_quaternion_to_matrix (&rotate, &res);
+  graphene_matrix_init_rotate (&check, 90.f, graphene_vec3_x_axis ());
+  graphene_assert_fuzzy_matrix_equal (&res, &check, 0.001);
+
+  if (g_test_verbose ())
+    g_test_message ("Reflected affine matrix...");
+  graphene_matrix_init_translate (&m, graphene_point3d_init (&t, 1.f, 2.f, 3.f));
+  graphene_matrix_rotate (&m, 30.f, graphene_vec3_init (&v, 0.f, 2.f, 3.f));
+  graphene_matrix_scale (&m, -2.f, 3.f, 4.f);
+
+  /* negating the rows to remove the reflection leaves a rotation of
+   * 180° around an axis close to X, which has no dominant w component
+   */
+
+  g_assert_true (graphene_matrix_decompose (&m, &translate, &scale, &rotate, &shear, &perspective));
+  graphene_assert_fuzzy_vec3_equal (&translate, graphene_vec3_init (&v, 1.f, 2.f, 3.f), 0.0001);
+  graphene_assert_fuzzy_vec3_equal (&shear, graphene_vec3_zero (), 0.0001);
+
+  graphene_matrix_interpolator_init (&i, &m, &m);
+  graphene_matrix_interpolator_interpolate (&i, 0.0, &res);
+  graphene_assert_fuzzy_matrix_equal (&res, &m, 0.0001);
+
+  if (g_test_verbose ())
+    g_test_message ("2D matrix...");
+  graphene_matrix_init_translate (&m, graphene_point3d_init (&t, 5.f, 6.f, 0.f));
+  graphene_matrix_skew_xy (&m, 0.5f);
+  graphene_matrix_scale (&m, -2.f, 2.f, 1.f);
+  g_assert_true (graphene_matrix_is_2d (&m));
+
+  g_assert_true (graphene_matrix_decompose (&m, &translate, &scale, &rotate, &shear, &perspective));
+  graphene_assert_fuzzy_vec3_equal (&translate, graphene_vec3_init (&v, 5.f, 6.f, 0.f), 0.0001);
+  graphene_assert_fuzzy_vec3_equal (&scale, graphene_vec3_init (&v, -2.f, 2.f, 1.f), 0.0001);
+  graphene_assert_fuzzy_vec3_equal (&shear, graphene_vec3_init (&v, 0.5f, 0.f, 0.f), 0.0001);
+
+  graphene_matrix_interpolator_init (&i, &m, &m);
+  graphene_matrix_interpolator_interpolate (&i, 0.0, &res);
+  graphene_assert_fuzzy_matrix_equal (&res, &m, 0.0001);
+
+  if (g_test_verbose ())
+    g_test_message ("Perspective matrix...");
+  graphene_matrix_init_rotate (&check, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_perspective (&check, 100.f, &m);
+
+  g_assert_true (graphene_matrix_decompose (&m, &translate, &scale, &rotate, &shear, &perspective));
+  graphene_assert_fuzzy_vec3_equal (&translate, graphene_vec3_zero (), 0.0001);
+  g_assert_false (graphene_vec4_near (&perspective, graphene_vec4_w_axis (), 0.0001));
+
+  graphene_matrix_interpolator_init (&i, &m, &m);
+  graphene_matrix_interpolator_interpolate (&i, 0.0, &res);
+  graphene_matrix_normalize (&m, &check);
+  graphene_assert_fuzzy_matrix_equal (&res, &check, 0.001);
+
+  if (g_test_verbose ())
+    g_test_message ("Singular matrix...");
+  graphene_matrix_init_scale (&m, 1.f, 0.f, 1.f);
+  g_assert_false (graphene_matrix_decompose (&m, &translate, &scale, &rotate, &shear, &perspective));
+
+  graphene_vec4_init (&w, 0.f, 0.f, 0.f, 0.f);
+  graphene_matrix_init_from_vec4 (&m, graphene_vec4_x_axis (), graphene_vec4_y_axis (), graphene_vec4_z_axis (), &w);
+  g_assert_false (graphene_matrix_decompose (&m, &translate, &scale, &rotate, &shear, &perspective));
+}
+GRAPHENE_TEST_UNIT_END
+
 GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/matrix/identity", matrix_identity)
   GRAPHENE_TEST_UNIT ("/matrix/scale", matrix_scale)
@@ -443,7 +922,16 @@ GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/matrix/neutral_element", matrix_neutral_element)
   GRAPHENE_TEST_UNIT ("/matrix/look_at", matrix_look_at)
   GRAPHENE_TEST_UNIT ("/matrix/invert", matrix_invert)
+  GRAPHENE_TEST_UNIT ("/matrix/invert/paths", matrix_invert_paths)
+  GRAPHENE_TEST_UNIT ("/matrix/normal-matrix", matrix_normal_matrix)
+  GRAPHENE_TEST_UNIT ("/matrix/equal-hash", matrix_equal_hash)
+  GRAPHENE_TEST_UNIT ("/matrix/transform-box", matrix_transform_box)
   GRAPHENE_TEST_UNIT ("/matrix/2d/identity", matrix_2d_identity)
   GRAPHENE_TEST_UNIT ("/matrix/2d/transforms", matrix_2d_transforms)
   GRAPHENE_TEST_UNIT ("/matrix/2d/round-trip", matrix_2d_round_trip)
+  GRAPHENE_TEST_UNIT ("/matrix/2d/axis-alignment", matrix_axis_alignment)
+  GRAPHENE_TEST_UNIT ("/matrix/2d/clip-rect", matrix_clip_rect)
+  GRAPHENE_TEST_UNIT ("/matrix/2d/bounds", matrix_2d_bounds)
+  GRAPHENE_TEST_UNIT ("/matrix/decompose", matrix_decompose)
+  GRAPHENE_TEST_UNIT ("/matrix/interpolator", matrix_interpolator)
 )
@@ -0,0 +1,123 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix3x4_conversion)
+{
+  graphene_matrix_t m, res;
+  graphene_matrix3x4_t m3x4;
+  graphene_point3d_t p;
+  graphene_vec3_t axis;
+  float v[16], check[16], v3x4[12];
+  unsigned int i;
+
+  g_assert_cmpint (sizeof (graphene_matrix3x4_t), ==, 48);
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_init (&axis, 1.f, 2.f, 3.f));
+  graphene_matrix_scale (&m, 2.f, -0.5f, 4.f);
+  graphene_matrix_translate (&m, graphene_point3d_init (&p, 4.f, -5.f, 6.f));
+
+  /* the conversion of an affine matrix is lossless */
+  graphene_matrix3x4_init_from_matrix (&m3x4, &m);
+  graphene_matrix3x4_to_matrix (&m3x4, &res);
+
+  graphene_matrix_to_float (&m, check);
+  graphene_matrix_to_float (&res, v);
+  for (i = 0; i < 16; i++)
+    g_assert_cmpfloat (v[i], ==, check[i]);
+
+  /* the values are stored transposed, without the last column */
+  graphene_matrix3x4_to_float (&m3x4, v3x4);
+  for (i = 0; i < 12; i++)
+    g_assert_cmpfloat (v3x4[i], ==, check[(i % 4) * 4 + i / 4]);
+
+  graphene_matrix3x4_init_from_float (&m3x4, v3x4);
+  graphene_matrix3x4_to_matrix (&m3x4, &res);
+  graphene_assert_fuzzy_matrix_equal (&res, &m, 0.00001);
+
+  graphene_matrix3x4_init_identity (&m3x4);
+  graphene_matrix3x4_to_matrix (&m3x4, &res);
+  g_assert_true (graphene_matrix_is_identity (&res));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix3x4_multiply)
+{
+  graphene_matrix_t a, b, res, check;
+  graphene_matrix3x4_t a3x4, b3x4, res3x4;
+  graphene_point3d_t p;
+
+  graphene_matrix_init_rotate (&a, 45.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&a, graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_matrix_init_scale (&b, 2.f, 3.f, 4.f);
+  graphene_matrix_rotate (&b, -30.f, graphene_vec3_x_axis ());
+  graphene_matrix_translate (&b, graphene_point3d_init (&p, -4.f, 5.f, 0.5f));
+
+  graphene_matrix3x4_init_from_matrix (&a3x4, &a);
+  graphene_matrix3x4_init_from_matrix (&b3x4, &b);
+
+  graphene_matrix_multiply (&a, &b, &check);
+  graphene_matrix3x4_multiply (&a3x4, &b3x4, &res3x4);
+  graphene_matrix3x4_to_matrix (&res3x4, &res);
+  graphene_assert_fuzzy_matrix_equal (&res, &check, 0.0001);
+
+  /* the inverse */
+  g_assert_true (graphene_matrix3x4_inverse (&res3x4, &a3x4));
+  graphene_matrix3x4_multiply (&res3x4, &a3x4, &b3x4);
+  graphene_matrix3x4_to_matrix (&b3x4, &res);
+  graphene_assert_fuzzy_matrix_equal (&res, graphene_matrix_init_identity (&check), 0.0001);
+
+  graphene_matrix_init_scale (&a, 1.f, 0.f, 1.f);
+  graphene_matrix3x4_init_from_matrix (&a3x4, &a);
+  g_assert_false (graphene_matrix3x4_inverse (&a3x4, &b3x4));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (matrix3x4_transform)
+{
+  graphene_matrix_t m;
+  graphene_matrix3x4_t m3x4;
+  graphene_point3d_t points[7], res[7], check, p;
+  graphene_vec3_t v, v_res, v_check;
+  graphene_box_t boxes[2], b_res[2], b_check[2];
+  unsigned int i;
+
+  graphene_matrix_init_rotate (&m, 60.f, graphene_vec3_z_axis ());
+  graphene_matrix_skew_xz (&m, 0.25f);
+  graphene_matrix_translate (&m, graphene_point3d_init (&p, 4.f, -5.f, 6.f));
+  graphene_matrix3x4_init_from_matrix (&m3x4, &m);
+
+  for (i = 0; i < 7; i++)
+    graphene_point3d_init (&points[i], i, 2.f - i, 0.5f * i);
+
+  graphene_matrix3x4_transform_points (&m3x4, 7, points, res);
+  for (i = 0; i < 7; i++)
+    {
+      graphene_matrix_transform_point3d (&m, &points[i], &check);
+      g_assert_true (graphene_point3d_near (&res[i], &check, 0.0001f));
+
+      graphene_matrix3x4_transform_point3d (&m3x4, &points[i], &check);
+      g_assert_true (graphene_point3d_near (&res[i], &check, 0.0001f));
+    }
+
+  /* vectors are not translated */
+  graphene_vec3_init (&v, 1.f, 2.f, 3.f);
+  graphene_matrix3x4_transform_vec3 (&m3x4, &v, &v_res);
+  graphene_matrix_transform_vec3 (&m, &v, &v_check);
+  graphene_assert_fuzzy_vec3_equal (&v_res, &v_check, 0.0001);
+
+  graphene_box_init (&boxes[0], graphene_point3d_init (&p, -1.f, -2.f, -3.f), &points[3]);
+  graphene_box_init (&boxes[1], &points[1], &points[6]);
+  graphene_matrix3x4_transform_boxes (&m3x4, 2, boxes, b_res);
+  graphene_matrix_transform_boxes (&m, 2, boxes, b_check);
+  for (i = 0; i < 2; i++)
+    g_assert_true (graphene_box_equal (&b_res[i], &b_check[i]));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/matrix3x4/conversion", matrix3x4_conversion)
+  GRAPHENE_TEST_UNIT ("/matrix3x4/multiply", matrix3x4_multiply)
+  GRAPHENE_TEST_UNIT ("/matrix3x4/transform", matrix3x4_transform)
+)
@@ -0,0 +1,132 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (polygon_init)
+{
+  graphene_point_t p[4] = {
+    GRAPHENE_POINT_INIT (0.f, 0.f),
+    GRAPHENE_POINT_INIT (10.f, 1.f),
+    GRAPHENE_POINT_INIT (10.f, 9.f),
+    GRAPHENE_POINT_INIT (0.f, 10.f),
+  };
+  graphene_rect_t bounds, r;
+  graphene_polygon_t *poly;
+  graphene_point_t v;
+  graphene_quad_t q;
+  unsigned int i;
+
+  graphene_quad_init_from_points (&q, p);
+
+  poly = graphene_polygon_init_from_quad (graphene_polygon_alloc (), &q);
+  g_assert_cmpuint (graphene_polygon_get_n_vertices (poly), ==, 4);
+
+  for (i = 0; i < 4; i++)
+    {
+      graphene_polygon_get_vertex (poly, i, &v);
+      g_assert_true (graphene_point_equal (&v, graphene_quad_get_point (&q, i)));
+    }
+
+  graphene_polygon_get_bounds (poly, &bounds);
+  graphene_quad_bounds (&q, &r);
+  g_assert_true (graphene_rect_equal (&bounds, &r));
+
+  graphene_polygon_init_from_rect (poly, &r);
+  graphene_assert_fuzzy_equals (graphene_polygon_get_area (poly), 100.f, 0.0001f);
+
+  graphene_polygon_free (poly);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (polygon_contains)
+{
+  graphene_point_t p[4] = {
+    GRAPHENE_POINT_INIT (0.f, 0.f),
+    GRAPHENE_POINT_INIT (10.f, 1.f),
+    GRAPHENE_POINT_INIT (10.f, 9.f),
+    GRAPHENE_POINT_INIT (0.f, 10.f),
+  };
+  graphene_polygon_t poly;
+  graphene_point_t a;
+  unsigned int i;
+
+  graphene_polygon_init (&poly, 4, p);
+  graphene_assert_fuzzy_equals (graphene_polygon_get_area (&poly), 90.f, 0.0001f);
+
+  for (i = 0; i < 4; i++)
+    g_assert_true (graphene_polygon_contains_point (&poly, &p[i]));
+
+  g_assert_true (graphene_polygon_contains_point (&poly, graphene_point_init (&a, 5.f, 5.f)));
+  g_assert_false (graphene_polygon_contains_point (&poly, graphene_point_init (&a, 10.f, 10.f)));
+  g_assert_false (graphene_polygon_contains_point (&poly, graphene_point_init (&a, -1.f, 5.f)));
+
+  /* the winding order does not matter */
+  graphene_polygon_init (&poly, 4, (graphene_point_t[]) { p[3], p[2], p[1], p[0] });
+  g_assert_true (graphene_polygon_contains_point (&poly, graphene_point_init (&a, 5.f, 5.f)));
+  g_assert_false (graphene_polygon_contains_point (&poly, graphene_point_init (&a, 10.f, 10.f)));
+
+  graphene_polygon_init (&poly, 2, p);
+  g_assert_false (graphene_polygon_contains_point (&poly, &p[0]));
+  g_assert_cmpfloat (graphene_polygon_get_area (&poly), ==, 0.f);
+
+  /* small polygons are not degenerate */
+  for (i = 0; i < 4; i++)
+    graphene_point_init (&p[i], p[i].x * 0.00001f, p[i].y * 0.00001f);
+  graphene_polygon_init (&poly, 4, p);
+  g_assert_true (graphene_polygon_contains_point (&poly, graphene_point_init (&a, 0.00005f, 0.00005f)));
+  g_assert_false (graphene_polygon_contains_point (&poly, graphene_point_init (&a, 0.0001f, 0.0001f)));
+
+  /* collinear vertices have no area */
+  graphene_polygon_init (&poly, 3, (graphene_point_t[]) {
+                           GRAPHENE_POINT_INIT (0.f, 0.f),
+                           GRAPHENE_POINT_INIT (1.f, 1.f),
+                           GRAPHENE_POINT_INIT (2.f, 2.f),
+                         });
+  g_assert_false (graphene_polygon_contains_point (&poly, graphene_point_init (&a, 1.f, 1.f)));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (polygon_intersect_rect)
+{
+  graphene_point_t diamond[4] = {
+    GRAPHENE_POINT_INIT (5.f, 0.f),
+    GRAPHENE_POINT_INIT (10.f, 5.f),
+    GRAPHENE_POINT_INIT (5.f, 10.f),
+    GRAPHENE_POINT_INIT (0.f, 5.f),
+  };
+  graphene_rect_t r = GRAPHENE_RECT_INIT (1.f, 1.f, 8.f, 8.f);
+  graphene_rect_t far = GRAPHENE_RECT_INIT (20.f, 20.f, 5.f, 5.f);
+  graphene_rect_t bounds;
+  graphene_polygon_t poly, res;
+  graphene_point_t a;
+
+  graphene_polygon_init (&poly, 4, diamond);
+
+  /* cutting the four corners of the diamond results in an octagon */
+  g_assert_true (graphene_polygon_intersect_rect (&poly, &r, &res));
+  g_assert_cmpuint (graphene_polygon_get_n_vertices (&res), ==, 8);
+  graphene_assert_fuzzy_equals (graphene_polygon_get_area (&res), 46.f, 0.001f);
+
+  graphene_polygon_get_bounds (&res, &bounds);
+  g_assert_true (graphene_rect_equal (&bounds, &r));
+
+  g_assert_true (graphene_polygon_contains_point (&res, graphene_point_init (&a, 5.f, 5.f)));
+  g_assert_false (graphene_polygon_contains_point (&res, graphene_point_init (&a, 5.f, 0.5f)));
+
+  /* a rectangle containing the polygon leaves it untouched */
+  graphene_rect_init (&r, -1.f, -1.f, 12.f, 12.f);
+  g_assert_true (graphene_polygon_intersect_rect (&poly, &r, &res));
+  g_assert_cmpuint (graphene_polygon_get_n_vertices (&res), ==, 4);
+  graphene_assert_fuzzy_equals (graphene_polygon_get_area (&res), 50.f, 0.001f);
+
+  g_assert_false (graphene_polygon_intersect_rect (&poly, &far, &res));
+  g_assert_cmpuint (graphene_polygon_get_n_vertices (&res), ==, 0);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/polygon/init", polygon_init)
+  GRAPHENE_TEST_UNIT ("/polygon/contains", polygon_contains)
+  GRAPHENE_TEST_UNIT ("/polygon/intersect-rect", polygon_intersect_rect)
+)
@@ -74,7 +74,50 @@ GRAPHENE_TEST_UNIT_BEGIN (quad_contains)
 }
 GRAPHENE_TEST_UNIT_END
 
+GRAPHENE_TEST_UNIT_BEGIN (quad_prepared_contains)
+{
+  graphene_point_t p[4] = {
+    GRAPHENE_POINT_INIT ( 0.f,  0.f),
+    GRAPHENE_POINT_INIT (10.f,  1.f),
+    GRAPHENE_POINT_INIT (10.f,  9.f),
+    GRAPHENE_POINT_INIT ( 0.f, 10.f),
+  };
+  graphene_point_t samples[11];
+  bool res[G_N_ELEMENTS (samples)];
+  graphene_prepared_quad_t *pq;
+  graphene_point_t a;
+  graphene_quad_t q;
+  unsigned int i, n_inside = 0;
+
+  graphene_quad_init_from_points (&q, p);
+  pq = graphene_prepared_quad_alloc ();
+  graphene_quad_prepare (&q, pq);
+
+  for (i = 0; i < 4; i++)
+    g_assert_true (graphene_prepared_quad_contains (pq, &p[i]));
+
+  g_assert_true (graphene_prepared_quad_contains (pq, graphene_point_init (&a, 5.f, 5.f)));
+  g_assert_false (graphene_prepared_quad_contains (pq, graphene_point_init (&a, 10.f, 10.f)));
+  g_assert_false (graphene_prepared_quad_contains (pq, graphene_point_init (&a, -1.f, 5.f)));
+
+  for (i = 0; i < G_N_ELEMENTS (samples); i++)
+    {
+      graphene_point_init (&samples[i], i * 1.2f - 1.f, i * 0.9f);
+      if (graphene_quad_contains (&q, &samples[i]))
+        n_inside += 1;
+    }
+
+  g_assert_cmpuint (graphene_prepared_quad_contains_points (pq, G_N_ELEMENTS (samples), samples, res), ==, n_inside);
+
+  for (i = 0; i < G_N_ELEMENTS (samples); i++)
+    g_assert_true (res[i] == graphene_quad_contains (&q, &samples[i]));
+
+  graphene_prepared_quad_free (pq);
+}
+GRAPHENE_TEST_UNIT_END
+
 GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/quad/bounds", quad_bounds)
   GRAPHENE_TEST_UNIT ("/quad/contains", quad_contains)
+  GRAPHENE_TEST_UNIT ("/quad/prepared/contains", quad_prepared_contains)
 )
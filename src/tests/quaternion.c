@@ -172,6 +172,144 @@ GRAPHENE_TEST_UNIT_BEGIN (quaternion_slerp)
 }
 GRAPHENE_TEST_UNIT_END
 
+GRAPHENE_TEST_UNIT_BEGIN (quaternion_multiply)
+{
+  graphene_quaternion_t q1, q2, q3, tmp;
+  graphene_matrix_t m1, m2, m3, check;
+
+  graphene_quaternion_init_from_angle_vec3 (&q1, 30.f, graphene_vec3_x_axis ());
+  graphene_quaternion_init_from_angle_vec3 (&q2, 45.f, graphene_vec3_y_axis ());
+
+  /* the identity is the neutral element */
+  graphene_quaternion_multiply (&q1, graphene_quaternion_init_identity (&tmp), &q3);
+  g_assert_true (graphene_quaternion_equal (&q1, &q3));
+
+  /* q1 * q2 rotates by q2 first, then by q1 */
+  graphene_quaternion_multiply (&q1, &q2, &q3);
+  graphene_quaternion_to_matrix (&q1, &m1);
+  graphene_quaternion_to_matrix (&q2, &m2);
+  graphene_quaternion_to_matrix (&q3, &m3);
+  graphene_matrix_multiply (&m2, &m1, &check);
+  graphene_assert_fuzzy_matrix_equal (&m3, &check, 0.0001);
+
+  /* the product with the inverse is the identity */
+  graphene_quaternion_invert (&q1, &tmp);
+  graphene_quaternion_multiply (&q1, &tmp, &q3);
+  g_assert_true (graphene_quaternion_equal (&q3, graphene_quaternion_init_identity (&tmp)));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (quaternion_rotate_vec3)
+{
+  graphene_quaternion_t q;
+  graphene_matrix_t m;
+  graphene_vec3_t v[5], res[5], check;
+  unsigned int i;
+
+  graphene_quaternion_init_from_angle_vec3 (&q, 90.f, graphene_vec3_z_axis ());
+  graphene_quaternion_rotate_vec3 (&q, graphene_vec3_x_axis (), &res[0]);
+  graphene_assert_fuzzy_vec3_equal (&res[0], graphene_vec3_y_axis (), 0.0001);
+
+  graphene_quaternion_init_from_angle_vec3 (&q, 60.f, graphene_vec3_init (&check, 1.f, 2.f, 3.f));
+  graphene_quaternion_to_matrix (&q, &m);
+
+  for (i = 0; i < 5; i++)
+    graphene_vec3_init (&v[i], i + 1.f, 2.f - i, i * 0.5f);
+
+  graphene_quaternion_rotate_vec3_array (&q, 5, v, res);
+  for (i = 0; i < 5; i++)
+    {
+      graphene_matrix_transform_vec3 (&m, &v[i], &check);
+      graphene_assert_fuzzy_vec3_equal (&res[i], &check, 0.0001);
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (quaternion_slerp_array)
+{
+  graphene_quaternion_t a[8], b[8], res[8], check, b_short;
+  graphene_vec3_t axis;
+  graphene_vec4_t v;
+  float factors[8];
+  unsigned int i;
+
+  for (i = 0; i < 7; i++)
+    {
+      graphene_vec3_init (&axis, 1.f, i + 1.f, 2.f - i);
+      graphene_quaternion_init_from_angle_vec3 (&a[i], i * 10.f, &axis);
+      graphene_quaternion_init_from_angle_vec3 (&b[i], 30.f + i * 20.f, &axis);
+      factors[i] = i / 6.f;
+    }
+
+  /* the same pair of quaternions yields the start quaternion */
+  b[3] = a[3];
+
+  /* a pair of quaternions in opposite hemispheres */
+  graphene_vec3_init (&axis, 1.f, 2.f, 3.f);
+  graphene_quaternion_init_from_angle_vec3 (&a[7], 40.f, &axis);
+  graphene_quaternion_init_from_angle_vec3 (&b_short, 60.f, &axis);
+  graphene_quaternion_to_vec4 (&b_short, &v);
+  graphene_vec4_negate (&v, &v);
+  graphene_quaternion_init_from_vec4 (&b[7], &v);
+  factors[7] = 0.3f;
+  g_assert_cmpfloat (graphene_quaternion_dot (&a[7], &b[7]), <, 0.f);
+
+  graphene_quaternion_slerp_array (8, a, b, factors, res);
+  for (i = 0; i < 8; i++)
+    {
+      graphene_quaternion_slerp (&a[i], &b[i], factors[i], &check);
+      graphene_assert_fuzzy_equals (graphene_quaternion_dot (&res[i], &check), 1.f, 0.00001);
+    }
+
+  /* unlike the spherical interpolation, the normalized one takes the
+   * shortest path, so the last pair interpolates towards -b
+   */
+  graphene_quaternion_nlerp_array (8, a, b, factors, res);
+  for (i = 0; i < 8; i++)
+    {
+      graphene_quaternion_slerp (&a[i], i == 7 ? &b_short : &b[i], factors[i], &check);
+      graphene_assert_fuzzy_equals (graphene_quaternion_dot (&res[i], &check), 1.f, 0.0001);
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (quaternion_matrix_array)
+{
+  graphene_quaternion_t q[9], res[9], check;
+  graphene_matrix_t m[9];
+  graphene_vec3_t axis;
+  unsigned int i;
+
+  for (i = 0; i < 5; i++)
+    {
+      graphene_vec3_init (&axis, 1.f, i + 1.f, 2.f - i);
+      graphene_quaternion_init_from_angle_vec3 (&q[i], i * 30.f, &axis);
+    }
+
+  /* rotations of about 180° have no dominant w component */
+  graphene_vec3_init (&axis, 1.f, 1.f, 0.f);
+  graphene_quaternion_init_from_angle_vec3 (&q[5], 180.f, &axis);
+  graphene_vec3_init (&axis, -2.f, 1.f, 3.f);
+  graphene_quaternion_init_from_angle_vec3 (&q[6], 179.9f, &axis);
+  graphene_vec3_init (&axis, 0.5f, 3.f, -1.f);
+  graphene_quaternion_init_from_angle_vec3 (&q[7], 170.f, &axis);
+  graphene_vec3_init (&axis, 0.2f, -0.5f, 4.f);
+  graphene_quaternion_init_from_angle_vec3 (&q[8], 175.f, &axis);
+
+  for (i = 0; i < 9; i++)
+    graphene_quaternion_to_matrix (&q[i], &m[i]);
+
+  graphene_quaternion_init_from_matrix_array (9, m, res);
+  for (i = 0; i < 9; i++)
+    {
+      graphene_quaternion_init_from_matrix (&check, &m[i]);
+      g_assert_true (graphene_quaternion_equal (&res[i], &check));
+
+      graphene_assert_fuzzy_equals (fabsf (graphene_quaternion_dot (&res[i], &q[i])), 1.f, 0.00001);
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
 GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/quaternion/init", quaternion_init)
   GRAPHENE_TEST_UNIT ("/quaternion/operators/invert", quaternion_operators_invert)
@@ -181,6 +319,10 @@ GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/quaternion/angles/to-from", quaternion_angles_to_from)
   GRAPHENE_TEST_UNIT ("/quaternion/vec4/to-from", quaternion_vec4_to_from)
   GRAPHENE_TEST_UNIT ("/quaternion/matrix/to-from", quaternion_matrix_to_from)
+  GRAPHENE_TEST_UNIT ("/quaternion/matrix/array", quaternion_matrix_array)
   GRAPHENE_TEST_UNIT ("/quaternion/angle-vec3/to-from", quaternion_angle_vec3_to_from)
   GRAPHENE_TEST_UNIT ("/quaternion/slerp", quaternion_slerp)
+  GRAPHENE_TEST_UNIT ("/quaternion/multiply", quaternion_multiply)
+  GRAPHENE_TEST_UNIT ("/quaternion/rotate-vec3", quaternion_rotate_vec3)
+  GRAPHENE_TEST_UNIT ("/quaternion/slerp-array", quaternion_slerp_array)
 )
@@ -55,6 +55,31 @@ GRAPHENE_TEST_UNIT_BEGIN (rect_equal)
 }
 GRAPHENE_TEST_UNIT_END
 
+GRAPHENE_TEST_UNIT_BEGIN (rect_hash)
+{
+  graphene_rect_t r = GRAPHENE_RECT_INIT (0.f, 0.f, 10.f, 10.f);
+  graphene_rect_t s = GRAPHENE_RECT_INIT (10.f, 10.f, -10.f, -10.f);
+  graphene_rect_t t = GRAPHENE_RECT_INIT (-0.f, -0.f, 10.f, 10.f);
+  graphene_rect_t u = GRAPHENE_RECT_INIT (1.f, 1.f, 9.f, 9.f);
+  graphene_rect_t v = GRAPHENE_RECT_INIT (0.00000001f, 0.f, 10.f, 10.f);
+
+  /* rectangles with negative sizes hash as their normalized version */
+  g_assert_true (graphene_rect_exact_equal (&r, &s));
+  g_assert_cmpuint (graphene_rect_hash (&r), ==, graphene_rect_hash (&s));
+
+  g_assert_true (graphene_rect_exact_equal (&r, &t));
+  g_assert_cmpuint (graphene_rect_hash (&r), ==, graphene_rect_hash (&t));
+
+  g_assert_false (graphene_rect_exact_equal (&r, &u));
+  g_assert_cmpuint (graphene_rect_hash (&r), !=, graphene_rect_hash (&u));
+
+  /* nearly equal rectangles are not exactly equal */
+  g_assert_true (graphene_rect_equal (&r, &v));
+  g_assert_false (graphene_rect_exact_equal (&r, &v));
+  g_assert_false (graphene_rect_exact_equal (&r, NULL));
+}
+GRAPHENE_TEST_UNIT_END
+
 GRAPHENE_TEST_UNIT_BEGIN (rect_contains_point)
 {
   graphene_rect_t r = GRAPHENE_RECT_INIT (0.f, 0.f, 10.f, 10.f);
@@ -119,6 +144,13 @@ GRAPHENE_TEST_UNIT_BEGIN (rect_intersect)
   g_assert_cmpfloat (j.origin.y, ==, 0.f);
   g_assert_cmpfloat (j.size.width, ==, 0.f);
   g_assert_cmpfloat (j.size.height, ==, 0.f);
+
+  graphene_rect_init (&q, -10.f, 5.f, 20.f, 10.f);
+  g_assert_true (graphene_rect_intersection (&r, &q, &j));
+  g_assert_cmpfloat (j.origin.x, ==, 0.f);
+  g_assert_cmpfloat (j.origin.y, ==, 5.f);
+  g_assert_cmpfloat (j.size.width, ==, 10.f);
+  g_assert_cmpfloat (j.size.height, ==, 5.f);
 }
 GRAPHENE_TEST_UNIT_END
 
@@ -250,6 +282,7 @@ GRAPHENE_TEST_SUITE (
   GRAPHENE_TEST_UNIT ("/rect/init", rect_init)
   GRAPHENE_TEST_UNIT ("/rect/normalize", rect_normalize)
   GRAPHENE_TEST_UNIT ("/rect/equal", rect_equal)
+  GRAPHENE_TEST_UNIT ("/rect/hash", rect_hash)
   GRAPHENE_TEST_UNIT ("/rect/contains/point", rect_contains_point)
   GRAPHENE_TEST_UNIT ("/rect/contains/rect", rect_contains_rect)
   GRAPHENE_TEST_UNIT ("/rect/intersect", rect_intersect)
@@ -0,0 +1,139 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+typedef struct {
+  float position[3];
+  float normal[3];
+  unsigned short bones[4];
+  float weights[4];
+} vertex_t;
+
+GRAPHENE_TEST_UNIT_BEGIN (skin_blend_matrices)
+{
+  vertex_t vertices[3] = {
+    { { 1.f, 2.f, 3.f }, { 1.f, 0.f, 0.f }, { 0, 0, 0, 0 }, { 1.f, 0.f, 0.f, 0.f } },
+    { { 1.f, 2.f, 3.f }, { 1.f, 0.f, 0.f }, { 0, 1, 0, 0 }, { 0.5f, 0.5f, 0.f, 0.f } },
+    { { 1.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 0, 2, 7, 0 }, { 0.5f, 0.5f, 0.25f, 0.f } },
+  };
+  float positions[3][3], normals[3][3];
+  float positions3x4[3][3], normals3x4[3][3];
+  graphene_skin_vertices_t v;
+  graphene_matrix_t bones[3];
+  graphene_matrix3x4_t bones3x4[3];
+  graphene_point3d_t p;
+  graphene_vec3_t res, check;
+  unsigned int i, j;
+
+  graphene_matrix_init_identity (&bones[0]);
+  graphene_matrix_init_translate (&bones[1], graphene_point3d_init (&p, 2.f, 0.f, 0.f));
+  graphene_matrix_init_rotate (&bones[2], 90.f, graphene_vec3_z_axis ());
+
+  v.n_vertices = 3;
+  v.positions = vertices[0].position;
+  v.positions_stride = sizeof (vertex_t);
+  v.normals = vertices[0].normal;
+  v.normals_stride = sizeof (vertex_t);
+  v.bones = vertices[0].bones;
+  v.bones_stride = sizeof (vertex_t);
+  v.weights = vertices[0].weights;
+  v.weights_stride = sizeof (vertex_t);
+  v.skinned_positions = positions[0];
+  v.skinned_positions_stride = sizeof (float) * 3;
+  v.skinned_normals = normals[0];
+  v.skinned_normals_stride = sizeof (float) * 3;
+
+  graphene_skin_vertices_blend_matrices (&v, 3, bones);
+
+  /* a single influence */
+  graphene_vec3_init_from_float (&res, positions[0]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 1.f, 2.f, 3.f), 0.0001);
+  graphene_vec3_init_from_float (&res, normals[0]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_x_axis (), 0.0001);
+
+  /* the translation is blended, and does not affect the normal */
+  graphene_vec3_init_from_float (&res, positions[1]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 2.f, 2.f, 3.f), 0.0001);
+  graphene_vec3_init_from_float (&res, normals[1]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_x_axis (), 0.0001);
+
+  /* the blended normal is normalized, and the bone outside of the
+   * palette is ignored
+   */
+  graphene_vec3_init_from_float (&res, positions[2]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 0.5f, 0.5f, 0.f), 0.0001);
+  graphene_vec3_init_from_float (&res, normals[2]);
+  graphene_vec3_normalize (graphene_vec3_init (&check, 1.f, 1.f, 0.f), &check);
+  graphene_assert_fuzzy_vec3_equal (&res, &check, 0.0001);
+
+  /* a palette of compact affine matrices gives the same results */
+  for (i = 0; i < 3; i++)
+    graphene_matrix3x4_init_from_matrix (&bones3x4[i], &bones[i]);
+
+  v.skinned_positions = positions3x4[0];
+  v.skinned_normals = normals3x4[0];
+  graphene_skin_vertices_blend_matrices3x4 (&v, 3, bones3x4);
+
+  for (i = 0; i < 3; i++)
+    {
+      for (j = 0; j < 3; j++)
+        {
+          graphene_assert_fuzzy_equals (positions3x4[i][j], positions[i][j], 0.0001);
+          graphene_assert_fuzzy_equals (normals3x4[i][j], normals[i][j], 0.0001);
+        }
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (skin_blend_dual_quaternions)
+{
+  vertex_t vertices[2] = {
+    { { 1.f, 2.f, 3.f }, { 1.f, 0.f, 0.f }, { 1, 0, 0, 0 }, { 1.f, 0.f, 0.f, 0.f } },
+    { { 1.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 0, 1, 7, 0 }, { 0.5f, 0.5f, 0.25f, 0.f } },
+  };
+  float positions[2][3], normals[2][3];
+  graphene_skin_vertices_t v;
+  graphene_dual_quaternion_t bones[2];
+  graphene_quaternion_t q;
+  graphene_vec3_t res, check;
+
+  graphene_dual_quaternion_init_identity (&bones[0]);
+  graphene_quaternion_init_from_angle_vec3 (&q, 90.f, graphene_vec3_z_axis ());
+  graphene_dual_quaternion_init_from_rotation (&bones[1], &q, graphene_vec3_init (&check, 0.f, 0.f, 1.f));
+
+  v.n_vertices = 2;
+  v.positions = vertices[0].position;
+  v.positions_stride = sizeof (vertex_t);
+  v.normals = vertices[0].normal;
+  v.normals_stride = sizeof (vertex_t);
+  v.bones = vertices[0].bones;
+  v.bones_stride = sizeof (vertex_t);
+  v.weights = vertices[0].weights;
+  v.weights_stride = sizeof (vertex_t);
+  v.skinned_positions = positions[0];
+  v.skinned_positions_stride = sizeof (float) * 3;
+  v.skinned_normals = normals[0];
+  v.skinned_normals_stride = sizeof (float) * 3;
+
+  graphene_skin_vertices_blend_dual_quaternions (&v, 2, bones);
+
+  graphene_vec3_init_from_float (&res, positions[0]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, -2.f, 1.f, 4.f), 0.0001);
+  graphene_vec3_init_from_float (&res, normals[0]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_y_axis (), 0.0001);
+
+  /* unlike linear blend skinning, the blended rotation keeps
+   * the distance of the vertex from the joint
+   */
+  graphene_vec3_init_from_float (&res, positions[1]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 0.7071068f, 0.7071068f, 0.5f), 0.0001);
+  graphene_vec3_init_from_float (&res, normals[1]);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 0.7071068f, 0.7071068f, 0.f), 0.0001);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/skin/blend-matrices", skin_blend_matrices)
+  GRAPHENE_TEST_UNIT ("/skin/blend-dual-quaternions", skin_blend_dual_quaternions)
+)
@@ -0,0 +1,132 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (tile_binner_grid)
+{
+  graphene_rect_t area = GRAPHENE_RECT_INIT (0.f, 0.f, 100.f, 50.f);
+  graphene_tile_binner_t *b;
+  unsigned int n_columns, n_rows, n;
+
+  b = graphene_tile_binner_init (graphene_tile_binner_alloc (), &area, 32.f, 32.f);
+
+  graphene_tile_binner_get_grid_size (b, &n_columns, &n_rows);
+  g_assert_cmpuint (n_columns, ==, 4);
+  g_assert_cmpuint (n_rows, ==, 2);
+  g_assert_cmpuint (graphene_tile_binner_get_n_items (b), ==, 0);
+
+  graphene_tile_binner_get_tile (b, 0, 0, &n);
+  g_assert_cmpuint (n, ==, 0);
+
+  g_assert_null (graphene_tile_binner_get_tile (b, 4, 0, &n));
+  g_assert_cmpuint (n, ==, 0);
+
+  graphene_tile_binner_free (b);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (tile_binner_rects)
+{
+  graphene_rect_t area = GRAPHENE_RECT_INIT (0.f, 0.f, 64.f, 64.f);
+  graphene_rect_t rects[] = {
+    GRAPHENE_RECT_INIT (0.f, 0.f, 64.f, 64.f),
+    GRAPHENE_RECT_INIT (40.f, 40.f, 10.f, 10.f),
+    GRAPHENE_RECT_INIT (-10.f, 10.f, 20.f, 10.f),
+    GRAPHENE_RECT_INIT (100.f, 100.f, 10.f, 10.f),
+    GRAPHENE_RECT_INIT (32.f, 0.f, -10.f, 40.f),
+  };
+  graphene_tile_binner_t *b;
+  const unsigned int *indices;
+  unsigned int n;
+
+  b = graphene_tile_binner_init (graphene_tile_binner_alloc (), &area, 32.f, 32.f);
+  graphene_tile_binner_add_rects (b, G_N_ELEMENTS (rects), rects);
+  g_assert_cmpuint (graphene_tile_binner_get_n_items (b), ==, G_N_ELEMENTS (rects));
+
+  indices = graphene_tile_binner_get_tile (b, 0, 0, &n);
+  g_assert_cmpuint (n, ==, 3);
+  g_assert_cmpuint (indices[0], ==, 0);
+  g_assert_cmpuint (indices[1], ==, 2);
+  g_assert_cmpuint (indices[2], ==, 4);
+
+  indices = graphene_tile_binner_get_tile (b, 1, 0, &n);
+  g_assert_cmpuint (n, ==, 1);
+  g_assert_cmpuint (indices[0], ==, 0);
+
+  indices = graphene_tile_binner_get_tile (b, 0, 1, &n);
+  g_assert_cmpuint (n, ==, 2);
+  g_assert_cmpuint (indices[0], ==, 0);
+  g_assert_cmpuint (indices[1], ==, 4);
+
+  indices = graphene_tile_binner_get_tile (b, 1, 1, &n);
+  g_assert_cmpuint (n, ==, 2);
+  g_assert_cmpuint (indices[0], ==, 0);
+  g_assert_cmpuint (indices[1], ==, 1);
+
+  /* re-initializing drops all items */
+  graphene_tile_binner_init (b, &area, 64.f, 64.f);
+  g_assert_cmpuint (graphene_tile_binner_add_rect (b, &rects[1]), ==, 0);
+
+  indices = graphene_tile_binner_get_tile (b, 0, 0, &n);
+  g_assert_cmpuint (n, ==, 1);
+  g_assert_cmpuint (indices[0], ==, 0);
+
+  graphene_tile_binner_free (b);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (tile_binner_quads)
+{
+  graphene_rect_t area = GRAPHENE_RECT_INIT (0.f, 0.f, 40.f, 40.f);
+  graphene_point_t diamond[4] = {
+    GRAPHENE_POINT_INIT (20.f, 0.f),
+    GRAPHENE_POINT_INIT (40.f, 20.f),
+    GRAPHENE_POINT_INIT (20.f, 40.f),
+    GRAPHENE_POINT_INIT (0.f, 20.f),
+  };
+  graphene_point_t dart[4] = {
+    GRAPHENE_POINT_INIT (0.f, 0.f),
+    GRAPHENE_POINT_INIT (40.f, 20.f),
+    GRAPHENE_POINT_INIT (10.f, 10.f),
+    GRAPHENE_POINT_INIT (20.f, 40.f),
+  };
+  graphene_quad_t quads[2];
+  graphene_tile_binner_t *b;
+  const unsigned int *indices;
+  unsigned int n;
+
+  graphene_quad_init_from_points (&quads[0], diamond);
+  graphene_quad_init_from_points (&quads[1], dart);
+
+  b = graphene_tile_binner_init (graphene_tile_binner_alloc (), &area, 8.f, 8.f);
+  graphene_tile_binner_add_quads (b, 2, quads);
+
+  /* the corners of the bounds are outside of the diamond */
+  indices = graphene_tile_binner_get_tile (b, 0, 0, &n);
+  g_assert_cmpuint (n, ==, 1);
+  g_assert_cmpuint (indices[0], ==, 1);
+
+  indices = graphene_tile_binner_get_tile (b, 4, 4, &n);
+  g_assert_cmpuint (n, ==, 1);
+  g_assert_cmpuint (indices[0], ==, 1);
+
+  indices = graphene_tile_binner_get_tile (b, 2, 2, &n);
+  g_assert_cmpuint (n, ==, 2);
+  g_assert_cmpuint (indices[0], ==, 0);
+  g_assert_cmpuint (indices[1], ==, 1);
+
+  /* concave quads fall back to their bounds */
+  indices = graphene_tile_binner_get_tile (b, 4, 0, &n);
+  g_assert_cmpuint (n, ==, 1);
+  g_assert_cmpuint (indices[0], ==, 1);
+
+  graphene_tile_binner_free (b);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/tile-binner/grid", tile_binner_grid)
+  GRAPHENE_TEST_UNIT ("/tile-binner/rects", tile_binner_rects)
+  GRAPHENE_TEST_UNIT ("/tile-binner/quads", tile_binner_quads)
+)
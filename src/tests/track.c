@@ -0,0 +1,185 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (track_vec3)
+{
+  const float times[3] = { 0.f, 1.f, 3.f };
+  graphene_vec3_t values[3], res, check;
+  graphene_track_cursor_t cursor;
+  graphene_track_t *t;
+  float start, end;
+  unsigned int i;
+
+  graphene_vec3_init (&values[0], 0.f, 0.f, 0.f);
+  graphene_vec3_init (&values[1], 1.f, 2.f, 3.f);
+  graphene_vec3_init (&values[2], 3.f, 2.f, 1.f);
+
+  t = graphene_track_init_vec3 (graphene_track_alloc (),
+                                GRAPHENE_TRACK_INTERPOLATION_LINEAR,
+                                3, times, values);
+  g_assert_cmpint (graphene_track_get_track_type (t), ==, GRAPHENE_TRACK_VEC3);
+  g_assert_cmpint (graphene_track_get_n_keys (t), ==, 3);
+
+  graphene_track_get_time_range (t, &start, &end);
+  g_assert_cmpfloat (start, ==, 0.f);
+  g_assert_cmpfloat (end, ==, 3.f);
+
+  graphene_track_sample_vec3 (t, NULL, 0.5f, &res);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 0.5f, 1.f, 1.5f), 0.0001);
+
+  graphene_track_sample_vec3 (t, NULL, 2.f, &res);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 2.f, 2.f, 2.f), 0.0001);
+
+  /* times outside the track are clamped */
+  graphene_track_sample_vec3 (t, NULL, -1.f, &res);
+  graphene_assert_fuzzy_vec3_equal (&res, &values[0], 0.0001);
+  graphene_track_sample_vec3 (t, NULL, 5.f, &res);
+  graphene_assert_fuzzy_vec3_equal (&res, &values[2], 0.0001);
+
+  /* sampling with a cursor gives the same results, in any order */
+  graphene_track_cursor_init (&cursor);
+  for (i = 0; i < 40; i++)
+    {
+      float time = (i < 30 ? i : 40 - i) * 0.125f - 0.5f;
+
+      graphene_track_sample_vec3 (t, &cursor, time, &res);
+      graphene_track_sample_vec3 (t, NULL, time, &check);
+      graphene_assert_fuzzy_vec3_equal (&res, &check, 0.0001);
+    }
+
+  /* the cubic interpolation goes through the keys, and keeps
+   * evenly spaced collinear keys on the same line
+   */
+  graphene_track_init_vec3 (t, GRAPHENE_TRACK_INTERPOLATION_CUBIC, 3, times, values);
+  for (i = 0; i < 3; i++)
+    {
+      graphene_track_sample_vec3 (t, NULL, times[i], &res);
+      graphene_assert_fuzzy_vec3_equal (&res, &values[i], 0.0001);
+    }
+
+  graphene_vec3_init (&values[2], 2.f, 4.f, 6.f);
+  graphene_track_init_vec3 (t, GRAPHENE_TRACK_INTERPOLATION_CUBIC, 3,
+                            (float[]) { 0.f, 1.f, 2.f },
+                            values);
+  graphene_track_sample_vec3 (t, NULL, 1.25f, &res);
+  graphene_assert_fuzzy_vec3_equal (&res, graphene_vec3_init (&check, 1.25f, 2.5f, 3.75f), 0.0001);
+
+  graphene_track_free (t);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (track_quaternion)
+{
+  const float times[3] = { 0.f, 1.f, 2.f };
+  graphene_quaternion_t values[3], res, check;
+  graphene_vec4_t v;
+  graphene_track_t *t;
+
+  graphene_quaternion_init_from_angle_vec3 (&values[0], 0.f, graphene_vec3_z_axis ());
+  graphene_quaternion_init_from_angle_vec3 (&values[1], 90.f, graphene_vec3_z_axis ());
+  graphene_quaternion_init_from_angle_vec3 (&values[2], 180.f, graphene_vec3_z_axis ());
+
+  t = graphene_track_init_quaternion (graphene_track_alloc (),
+                                      GRAPHENE_TRACK_INTERPOLATION_SLERP,
+                                      3, times, values);
+
+  graphene_track_sample_quaternion (t, NULL, 0.5f, &res);
+  graphene_quaternion_init_from_angle_vec3 (&check, 45.f, graphene_vec3_z_axis ());
+  g_assert_true (graphene_quaternion_equal (&res, &check));
+
+  graphene_track_sample_quaternion (t, NULL, 1.25f, &res);
+  graphene_quaternion_slerp (&values[1], &values[2], 0.25f, &check);
+  g_assert_true (graphene_quaternion_equal (&res, &check));
+
+  /* the negated key describes the same rotation, and the track
+   * still interpolates along the shortest path
+   */
+  graphene_quaternion_to_vec4 (&values[1], &v);
+  graphene_vec4_negate (&v, &v);
+  graphene_quaternion_init_from_vec4 (&values[1], &v);
+  graphene_track_init_quaternion (t, GRAPHENE_TRACK_INTERPOLATION_LINEAR, 3, times, values);
+
+  graphene_track_sample_quaternion (t, NULL, 0.5f, &res);
+  graphene_quaternion_init_from_angle_vec3 (&check, 45.f, graphene_vec3_z_axis ());
+  g_assert_true (graphene_quaternion_equal (&res, &check));
+
+  graphene_track_free (t);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (track_matrix)
+{
+  const float times[2] = { 0.f, 2.f };
+  graphene_matrix_t values[2], res, check;
+  graphene_point3d_t p;
+  graphene_track_t *t;
+
+  graphene_matrix_init_translate (&values[0], graphene_point3d_init (&p, 0.f, 0.f, 0.f));
+  graphene_matrix_init_translate (&values[1], graphene_point3d_init (&p, 2.f, 4.f, 6.f));
+
+  t = graphene_track_init_matrix (graphene_track_alloc (),
+                                  GRAPHENE_TRACK_INTERPOLATION_LINEAR,
+                                  2, times, values);
+
+  graphene_track_sample_matrix (t, NULL, 1.f, &res);
+  graphene_matrix_init_translate (&check, graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_assert_fuzzy_matrix_equal (&res, &check, 0.0001);
+
+  graphene_matrix_init_identity (&values[0]);
+  graphene_matrix_init_rotate (&values[1], 90.f, graphene_vec3_z_axis ());
+  graphene_track_init_matrix (t, GRAPHENE_TRACK_INTERPOLATION_SLERP, 2, times, values);
+
+  graphene_track_sample_matrix (t, NULL, 1.f, &res);
+  graphene_matrix_init_rotate (&check, 45.f, graphene_vec3_z_axis ());
+  graphene_assert_fuzzy_matrix_equal (&res, &check, 0.0001);
+
+  graphene_track_free (t);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (track_sample_array)
+{
+  const float times[2] = { 0.f, 1.f };
+  graphene_track_t *tracks[5];
+  graphene_track_cursor_t cursors[5];
+  graphene_quaternion_t keys[2], q;
+  graphene_vec4_t v;
+  float res[5 * 4];
+  unsigned int i;
+
+  for (i = 0; i < 5; i++)
+    {
+      graphene_quaternion_init (&keys[0], 0.f, 0.f, 0.f, 1.f);
+      graphene_quaternion_init_from_angle_vec3 (&keys[1], 20.f * (i + 1), graphene_vec3_x_axis ());
+
+      tracks[i] = graphene_track_init_quaternion (graphene_track_alloc (),
+                                                  GRAPHENE_TRACK_INTERPOLATION_SLERP,
+                                                  2, times, keys);
+      graphene_track_cursor_init (&cursors[i]);
+    }
+
+  graphene_track_sample_array (5, (const graphene_track_t **) tracks, cursors, 0.5f, res);
+
+  for (i = 0; i < 5; i++)
+    {
+      graphene_track_sample_quaternion (tracks[i], NULL, 0.5f, &q);
+      graphene_quaternion_to_vec4 (&q, &v);
+
+      graphene_assert_fuzzy_equals (res[0 * 5 + i], graphene_vec4_get_x (&v), 0.0001);
+      graphene_assert_fuzzy_equals (res[1 * 5 + i], graphene_vec4_get_y (&v), 0.0001);
+      graphene_assert_fuzzy_equals (res[2 * 5 + i], graphene_vec4_get_z (&v), 0.0001);
+      graphene_assert_fuzzy_equals (res[3 * 5 + i], graphene_vec4_get_w (&v), 0.0001);
+
+      graphene_track_free (tracks[i]);
+    }
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/track/vec3", track_vec3)
+  GRAPHENE_TEST_UNIT ("/track/quaternion", track_quaternion)
+  GRAPHENE_TEST_UNIT ("/track/matrix", track_matrix)
+  GRAPHENE_TEST_UNIT ("/track/sample-array", track_sample_array)
+)
@@ -0,0 +1,126 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (transform_builder_empty)
+{
+  graphene_transform_builder_t *b;
+  graphene_matrix_t m;
+
+  b = graphene_transform_builder_init (graphene_transform_builder_alloc ());
+  g_assert_cmpint (graphene_transform_builder_get_n_ops (b), ==, 0);
+
+  graphene_transform_builder_to_matrix (b, &m);
+  g_assert_true (graphene_matrix_is_identity (&m));
+
+  graphene_transform_builder_free (b);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (transform_builder_compose)
+{
+  graphene_transform_builder_t *b;
+  graphene_matrix_t m, check, skew;
+  graphene_point3d_t p;
+  graphene_vec3_t axis;
+
+  graphene_matrix_init_identity (&skew);
+  graphene_matrix_skew_xy (&skew, 0.5f);
+
+  b = graphene_transform_builder_init (graphene_transform_builder_alloc ());
+
+  graphene_matrix_init_identity (&check);
+
+  graphene_transform_builder_translate (b, graphene_point3d_init (&p, 10.f, 20.f, 0.f));
+  graphene_matrix_translate (&check, &p);
+  graphene_transform_builder_translate (b, graphene_point3d_init (&p, -5.f, 0.f, 3.f));
+  graphene_matrix_translate (&check, &p);
+
+  graphene_transform_builder_rotate (b, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_rotate_z (&check, 30.f);
+  graphene_transform_builder_rotate (b, 15.f, graphene_vec3_z_axis ());
+  graphene_matrix_rotate_z (&check, 15.f);
+
+  graphene_transform_builder_scale (b, 2.f, 3.f, 1.f);
+  graphene_matrix_scale (&check, 2.f, 3.f, 1.f);
+
+  graphene_transform_builder_rotate (b, -60.f, graphene_vec3_x_axis ());
+  graphene_matrix_rotate_x (&check, -60.f);
+  graphene_transform_builder_rotate (b, 75.f, graphene_vec3_y_axis ());
+  graphene_matrix_rotate_y (&check, 75.f);
+
+  graphene_transform_builder_rotate (b, 45.f, graphene_vec3_init (&axis, 1.f, 2.f, 3.f));
+  graphene_matrix_rotate (&check, 45.f, &axis);
+
+  graphene_transform_builder_transform (b, &skew);
+  graphene_matrix_multiply (&skew, &check, &check);
+
+  graphene_transform_builder_translate (b, graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_matrix_translate (&check, &p);
+
+  /* the consecutive translations and rotations are merged */
+  g_assert_cmpint (graphene_transform_builder_get_n_ops (b), ==, 8);
+
+  graphene_transform_builder_to_matrix (b, &m);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  /* re-initializing the builder drops the recorded operations */
+  graphene_transform_builder_init (b);
+  graphene_transform_builder_scale (b, 2.f, 2.f, 2.f);
+  graphene_transform_builder_to_matrix (b, &m);
+  graphene_matrix_init_scale (&check, 2.f, 2.f, 2.f);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  graphene_transform_builder_free (b);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (transform_builder_matrix_ops)
+{
+  graphene_matrix_t m, op, check;
+  graphene_point3d_t p;
+  graphene_vec3_t axis;
+
+  /* the in-place transformations match a full multiplication */
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_init (&axis, 1.f, -1.f, 2.f));
+  graphene_matrix_translate (&m, graphene_point3d_init (&p, 1.f, 2.f, 3.f));
+  graphene_matrix_perspective (&m, 100.f, &m);
+
+  graphene_matrix_init_translate (&op, graphene_point3d_init (&p, -4.f, 5.f, 6.f));
+  graphene_matrix_multiply (&op, &m, &check);
+  graphene_matrix_translate (&m, &p);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  graphene_matrix_init_scale (&op, 2.f, -3.f, 0.5f);
+  graphene_matrix_multiply (&op, &m, &check);
+  graphene_matrix_scale (&m, 2.f, -3.f, 0.5f);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  graphene_matrix_init_rotate (&op, 20.f, graphene_vec3_x_axis ());
+  graphene_matrix_multiply (&op, &m, &check);
+  graphene_matrix_rotate_x (&m, 20.f);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  graphene_matrix_init_rotate (&op, 40.f, graphene_vec3_y_axis ());
+  graphene_matrix_multiply (&op, &m, &check);
+  graphene_matrix_rotate_y (&m, 40.f);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  graphene_matrix_init_rotate (&op, -70.f, graphene_vec3_z_axis ());
+  graphene_matrix_multiply (&op, &m, &check);
+  graphene_matrix_rotate_z (&m, -70.f);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+
+  graphene_matrix_init_rotate (&op, 110.f, &axis);
+  graphene_matrix_multiply (&op, &m, &check);
+  graphene_matrix_rotate (&m, 110.f, &axis);
+  graphene_assert_fuzzy_matrix_equal (&m, &check, 0.0001);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/transform-builder/empty", transform_builder_empty)
+  GRAPHENE_TEST_UNIT ("/transform-builder/compose", transform_builder_compose)
+  GRAPHENE_TEST_UNIT ("/transform-builder/matrix-ops", transform_builder_matrix_ops)
+)
@@ -0,0 +1,87 @@
+#include <glib.h>
+#include <graphene.h>
+
+#include "graphene-test-compat.h"
+
+GRAPHENE_TEST_UNIT_BEGIN (unprojector_point3d)
+{
+  graphene_matrix_t projection, modelview;
+  graphene_point3d_t points[7], res[7], check, pos;
+  graphene_unprojector_t u;
+  unsigned int i;
+
+  graphene_matrix_init_perspective (&projection, 60.f, 4.f / 3.f, 0.1f, 100.f);
+  graphene_matrix_init_rotate (&modelview, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&modelview, graphene_point3d_init (&pos, 1.f, 2.f, 10.f));
+
+  g_assert_true (graphene_unprojector_is_valid (graphene_unprojector_init (&u, &projection, &modelview)));
+
+  for (i = 0; i < 7; i++)
+    graphene_point3d_init (&points[i], -0.75f + 0.25f * i, 0.5f - 0.125f * i, -1.f + 0.3f * i);
+
+  graphene_unprojector_unproject_points (&u, 7, points, res);
+
+  for (i = 0; i < 7; i++)
+    {
+      graphene_matrix_unproject_point3d (&projection, &modelview, &points[i], &check);
+      g_assert_true (graphene_point3d_near (&res[i], &check, 0.001f));
+
+      graphene_unprojector_unproject_point3d (&u, &points[i], &check);
+      g_assert_true (graphene_point3d_near (&res[i], &check, 0.001f));
+    }
+
+  /* a singular projection leaves the points unchanged */
+  graphene_matrix_init_scale (&projection, 1.f, 1.f, 0.f);
+  g_assert_false (graphene_unprojector_is_valid (graphene_unprojector_init (&u, &projection, &modelview)));
+
+  graphene_unprojector_unproject_points (&u, 7, points, res);
+  for (i = 0; i < 7; i++)
+    g_assert_true (graphene_point3d_equal (&res[i], &points[i]));
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_UNIT_BEGIN (unprojector_ray)
+{
+  graphene_matrix_t projection, view, modelview, clip;
+  graphene_vec4_t v;
+  graphene_point3d_t target, origin, pos;
+  graphene_point_t p;
+  graphene_vec3_t direction;
+  graphene_unprojector_t *u;
+  graphene_ray_t r;
+  float w;
+
+  graphene_matrix_init_perspective (&projection, 45.f, 1.f, 1.f, 50.f);
+  graphene_matrix_init_translate (&view, graphene_point3d_init (&pos, 0.f, 0.f, -5.f));
+  graphene_matrix_rotate (&view, 20.f, graphene_vec3_x_axis ());
+  graphene_matrix_inverse (&view, &modelview);
+  graphene_matrix_multiply (&view, &projection, &clip);
+
+  /* project a point on screen, and check that the ray goes through it */
+  graphene_point3d_init (&target, 1.f, -0.5f, -3.f);
+  graphene_vec4_init (&v, target.x, target.y, target.z, 1.f);
+  graphene_matrix_transform_vec4 (&clip, &v, &v);
+  w = graphene_vec4_get_w (&v);
+  graphene_point_init (&p, graphene_vec4_get_x (&v) / w, graphene_vec4_get_y (&v) / w);
+
+  u = graphene_unprojector_init (graphene_unprojector_alloc (), &projection, &modelview);
+  graphene_unprojector_get_ray (u, &p, &r);
+  graphene_unprojector_free (u);
+
+  g_assert_cmpfloat (graphene_ray_get_distance_to_point (&r, &target), <, 0.001f);
+
+  /* the ray starts on the near plane, and it is normalized */
+  graphene_ray_get_origin (&r, &origin);
+  graphene_ray_get_direction (&r, &direction);
+  graphene_assert_fuzzy_equals (graphene_vec3_length (&direction), 1.f, 0.0001);
+  graphene_point3d_init (&pos, 0.f, 0.f, 0.f);
+  graphene_matrix_transform_point3d (&modelview, &pos, &pos);
+  g_assert_cmpfloat (graphene_point3d_distance (&origin, &pos, NULL), >=, 1.f - 0.0001f);
+  g_assert_cmpfloat (graphene_point3d_distance (&origin, &pos, NULL), <, 1.5f);
+}
+GRAPHENE_TEST_UNIT_END
+
+GRAPHENE_TEST_SUITE (
+  GRAPHENE_TEST_UNIT ("/unprojector/point3d", unprojector_point3d)
+  GRAPHENE_TEST_UNIT ("/unprojector/ray", unprojector_ray)
+)